@@ -0,0 +1,117 @@
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/batch.hpp>
+
+namespace
+{
+
+enum class store_error
+{
+    bad_key,
+    missing,
+};
+
+using Key = zeus::expected<std::uint64_t, store_error>;
+using Row = zeus::expected<std::uint64_t, store_error>;
+
+// A storage client whose every call pays a fixed overhead, standing for a
+// network round trip, on top of a small cost per key.
+struct store
+{
+    std::chrono::nanoseconds call_overhead;
+
+    void round_trip() const
+    {
+        if (call_overhead.count() == 0)
+        {
+            return;
+        }
+        auto const until = std::chrono::steady_clock::now() + call_overhead;
+        while (std::chrono::steady_clock::now() < until)
+        {
+        }
+    }
+
+    static Row lookup(std::uint64_t key)
+    {
+        if (key % 50 == 0)
+            return zeus::unexpected(store_error::missing);
+        return key * 2'654'435'761u;
+    }
+
+    Row get(std::uint64_t key) const
+    {
+        round_trip();
+        return lookup(key);
+    }
+
+    std::vector<Row> multi_get(const std::vector<std::uint64_t> &keys) const
+    {
+        round_trip();
+        std::vector<Row> rows;
+        rows.reserve(keys.size());
+        for (std::uint64_t key : keys)
+        {
+            rows.push_back(lookup(key));
+        }
+        return rows;
+    }
+};
+
+// one key in ten failed to parse
+std::vector<Key> make_keys(std::size_t n)
+{
+    std::vector<Key> keys;
+    keys.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i % 10 == 9)
+            keys.emplace_back(zeus::unexpect, store_error::bad_key);
+        else
+            keys.emplace_back(i);
+    }
+    return keys;
+}
+
+void run_benchmarks(std::chrono::nanoseconds call_overhead, const char *name)
+{
+    std::vector<Key> const keys = make_keys(1'000);
+    store const            s {call_overhead};
+
+    auto const per_item = [&]() {
+        std::vector<Row> rows;
+        rows.reserve(keys.size());
+        for (const Key &k : keys)
+        {
+            rows.push_back(k.and_then([&s](std::uint64_t key) { return s.get(key); }));
+        }
+        return rows;
+    };
+    auto const batched = [&]() {
+        return zeus::batch_and_then(keys, [&s](const std::vector<std::uint64_t> &batch) { return s.multi_get(batch); });
+    };
+    CHECK(per_item() == batched());
+
+    BENCHMARK(std::string("and_then per item, ") + name)
+    {
+        return per_item();
+    };
+    BENCHMARK(std::string("batch_and_then, ") + name)
+    {
+        return batched();
+    };
+}
+
+} // namespace
+
+TEST_CASE("batch_and_then over 1000 keys", "[benchmark][batch]")
+{
+    run_benchmarks(std::chrono::nanoseconds {0}, "no call overhead");
+    run_benchmarks(std::chrono::microseconds {1}, "1 us per call");
+}
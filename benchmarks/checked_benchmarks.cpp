@@ -0,0 +1,104 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/checked.hpp>
+
+namespace
+{
+
+using index_result = zeus::expected<void, zeus::first_overflow_index>;
+
+// what the span-level operations replace: the scalar checked operation in
+// a loop that stops at the first overflow
+template<class T, class F>
+index_result scalar_loop(const std::vector<T> &a, const std::vector<T> &b, std::vector<T> &out, F f)
+{
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        auto const r = f(a[i], b[i]);
+        if (!r.has_value())
+        {
+            return index_result(zeus::unexpect, zeus::first_overflow_index {i, r.error()});
+        }
+        out[i] = *r;
+    }
+    return {};
+}
+
+template<class T>
+void run_benchmarks(const char *name)
+{
+    // 64K elements: the operands and the results stay in cache
+    std::size_t const n = 65'536;
+    std::vector<T>    a(n);
+    std::vector<T>    b(n);
+    std::vector<T>    out(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = static_cast<T>(i * 2'654'435'761u % 100'000);
+        b[i] = static_cast<T>(i % 1'000) - 500;
+    }
+
+    auto const add = [](T x, T y) { return zeus::checked_add(x, y); };
+    auto const mul = [](T x, T y) { return zeus::checked_mul(x, y); };
+    REQUIRE(scalar_loop(a, b, out, add).has_value());
+    REQUIRE(zeus::simd::checked_mul(a, b, out).has_value());
+
+    BENCHMARK(std::string("checked_add() loop, ") + name)
+    {
+        return scalar_loop(a, b, out, add);
+    };
+    BENCHMARK(std::string("simd::checked_add(), ") + name)
+    {
+        return zeus::simd::checked_add(a, b, out);
+    };
+    BENCHMARK(std::string("checked_mul() loop, ") + name)
+    {
+        return scalar_loop(a, b, out, mul);
+    };
+    BENCHMARK(std::string("simd::checked_mul(), ") + name)
+    {
+        return zeus::simd::checked_mul(a, b, out);
+    };
+}
+
+} // namespace
+
+TEST_CASE("checked arithmetic over 64K integers", "[benchmark][checked]")
+{
+    run_benchmarks<std::int32_t>("int32");
+    run_benchmarks<std::int64_t>("int64");
+}
+
+TEST_CASE("checked narrowing of 64K integers", "[benchmark][checked]")
+{
+    std::size_t const         n = 65'536;
+    std::vector<std::int64_t> in(n);
+    std::vector<std::int32_t> out(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        in[i] = static_cast<std::int64_t>(i * 2'654'435'761u % 2'000'000'000);
+    }
+
+    BENCHMARK("checked_narrow() loop")
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            auto const r = zeus::checked_narrow<std::int32_t>(in[i]);
+            if (!r.has_value())
+            {
+                return index_result(zeus::unexpect, zeus::first_overflow_index {i, r.error()});
+            }
+            out[i] = *r;
+        }
+        return index_result();
+    };
+    BENCHMARK("simd::checked_narrow()")
+    {
+        return zeus::simd::checked_narrow(in, out);
+    };
+}
@@ -0,0 +1,83 @@
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/collect.hpp>
+
+namespace
+{
+
+enum class parse_error
+{
+    out_of_range,
+};
+
+using Result = zeus::expected<int, parse_error>;
+
+constexpr std::size_t size = 10'000'000;
+
+std::vector<Result> make_results(std::size_t error_at)
+{
+    std::vector<Result> results;
+    results.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (i == error_at)
+            results.emplace_back(zeus::unexpect, parse_error::out_of_range);
+        else
+            results.emplace_back(static_cast<int>(i));
+    }
+    return results;
+}
+
+// the loop usually written by hand
+zeus::expected<std::vector<int>, parse_error> collect_by_hand(const std::vector<Result> &results)
+{
+    std::vector<int> values;
+    for (const Result &r : results)
+    {
+        if (!r)
+            return zeus::unexpected(r.error());
+        values.push_back(*r);
+    }
+    return values;
+}
+
+} // namespace
+
+TEST_CASE("collect() on 10M elements", "[benchmark][collect]")
+{
+    std::vector<Result> const all_values = make_results(size);
+    std::vector<Result> const late_error = make_results(size - 1);
+    std::vector<Result> const mid_error  = make_results(size / 2);
+
+    CHECK(zeus::collect(all_values) == collect_by_hand(all_values));
+    CHECK(zeus::collect(mid_error) == collect_by_hand(mid_error));
+
+    BENCHMARK("hand-written loop, all values")
+    {
+        return collect_by_hand(all_values);
+    };
+    BENCHMARK("collect(), all values")
+    {
+        return zeus::collect(all_values);
+    };
+    BENCHMARK("hand-written loop, error at the end")
+    {
+        return collect_by_hand(late_error);
+    };
+    BENCHMARK("collect(), error at the end")
+    {
+        return zeus::collect(late_error);
+    };
+    BENCHMARK("collect(), error in the middle")
+    {
+        return zeus::collect(mid_error);
+    };
+    BENCHMARK_ADVANCED("collect() from an rvalue range")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<std::vector<Result>> inputs(static_cast<std::size_t>(meter.runs()), all_values);
+        meter.measure([&](int i) { return zeus::collect(std::move(inputs[static_cast<std::size_t>(i)])); });
+    };
+}
@@ -0,0 +1,70 @@
+#include <string>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/context.hpp>
+
+namespace
+{
+
+enum class io_error
+{
+    not_found,
+};
+
+constexpr int depth = 10;
+
+#if defined(_MSC_VER)
+    #define NOINLINE __declspec(noinline)
+#else
+    #define NOINLINE __attribute__((noinline))
+#endif
+
+// Each layer adds "while loading layer N" to the error, the way nested
+// calls would on their way up.
+
+NOINLINE zeus::expected<int, std::string> load_string(int layer)
+{
+    if (layer == 0)
+        return zeus::unexpected(std::string("not found"));
+    return load_string(layer - 1).transform_error([layer](std::string &&e) {
+        return "while loading layer " + std::to_string(layer) + ": " + std::move(e);
+    });
+}
+
+NOINLINE zeus::expected<int, zeus::context_error<io_error>> load_context(int layer)
+{
+    static char const *const names[] = {
+        "while loading layer 0",
+        "while loading layer 1",
+        "while loading layer 2",
+        "while loading layer 3",
+        "while loading layer 4",
+        "while loading layer 5",
+        "while loading layer 6",
+        "while loading layer 7",
+        "while loading layer 8",
+        "while loading layer 9",
+        "while loading layer 10",
+    };
+    if (layer == 0)
+        return zeus::unexpected(io_error::not_found);
+    return load_context(layer - 1) | zeus::with_context(names[layer]);
+}
+
+} // namespace
+
+TEST_CASE("context chaining vs string concatenation", "[benchmark][context]")
+{
+    CHECK(load_context(depth).error().depth() == depth);
+
+    BENCHMARK("std::string concatenation, 10 layers")
+    {
+        return load_string(depth);
+    };
+    BENCHMARK("context_error, 10 layers")
+    {
+        return load_context(depth);
+    };
+}
@@ -0,0 +1,83 @@
+#include <zeus/expected/coroutine.hpp>
+
+#if ZEUS_EXPECTED_HAS_COROUTINES
+
+    #include <catch2/catch_all.hpp>
+
+    #include <zeus/expected.hpp>
+
+namespace
+{
+
+enum class parse_error
+{
+    empty,
+    not_a_digit,
+};
+
+using Result = zeus::expected<int, parse_error>;
+
+    #if defined(_MSC_VER)
+        #define NOINLINE __declspec(noinline)
+    #else
+        #define NOINLINE __attribute__((noinline))
+    #endif
+
+NOINLINE Result parse_digit(char c)
+{
+    if (c == '\0')
+        return zeus::unexpected(parse_error::empty);
+    if (c < '0' || c > '9')
+        return zeus::unexpected(parse_error::not_a_digit);
+    return c - '0';
+}
+
+Result parse_hand_written(const char *s)
+{
+    int value = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        Result d = parse_digit(s[i]);
+        if (!d)
+            return zeus::unexpected(d.error());
+        value = value * 10 + *d;
+    }
+    return value;
+}
+
+Result parse_coroutine(const char *s)
+{
+    int value = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        value = value * 10 + co_await parse_digit(s[i]);
+    }
+    co_return value;
+}
+
+} // namespace
+
+TEST_CASE("co_await vs hand-written early return", "[benchmark][coroutine]")
+{
+    CHECK(parse_hand_written("1234") == parse_coroutine("1234"));
+    CHECK(parse_hand_written("12x4") == parse_coroutine("12x4"));
+
+    BENCHMARK("hand-written, success")
+    {
+        return parse_hand_written("1234");
+    };
+    BENCHMARK("co_await, success")
+    {
+        return parse_coroutine("1234");
+    };
+    BENCHMARK("hand-written, error")
+    {
+        return parse_hand_written("12x4");
+    };
+    BENCHMARK("co_await, error")
+    {
+        return parse_coroutine("12x4");
+    };
+}
+
+#endif
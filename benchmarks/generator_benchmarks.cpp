@@ -0,0 +1,100 @@
+#include <zeus/expected/generator.hpp>
+
+#if ZEUS_EXPECTED_HAS_COROUTINES
+
+    #include <string>
+    #include <vector>
+
+    #include <catch2/catch_all.hpp>
+
+    #include <zeus/expected.hpp>
+
+namespace
+{
+
+enum class parse_error
+{
+    empty,
+    not_a_number,
+};
+
+using Result = zeus::expected<long, parse_error>;
+
+Result parse(const std::string &s)
+{
+    if (s.empty())
+        return zeus::unexpected(parse_error::empty);
+    long value = 0;
+    for (char c : s)
+    {
+        if (c < '0' || c > '9')
+            return zeus::unexpected(parse_error::not_a_number);
+        value = value * 10 + (c - '0');
+    }
+    return value;
+}
+
+std::vector<std::string> make_inputs(std::size_t n)
+{
+    std::vector<std::string> inputs;
+    inputs.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        inputs.push_back(i % 100 == 99 ? std::string("x") : std::to_string(i));
+    }
+    return inputs;
+}
+
+std::vector<Result> parse_to_vector(const std::vector<std::string> &inputs)
+{
+    std::vector<Result> out;
+    out.reserve(inputs.size());
+    for (const std::string &s : inputs)
+    {
+        out.push_back(parse(s));
+    }
+    return out;
+}
+
+zeus::expected_generator<long, parse_error> parse_lazily(const std::vector<std::string> &inputs)
+{
+    for (const std::string &s : inputs)
+    {
+        co_yield parse(s);
+    }
+}
+
+template<class Range>
+long sum_values(Range &&results)
+{
+    long sum = 0;
+    for (const Result &r : results)
+    {
+        sum += r.value_or(0);
+    }
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("expected_generator vs materialized vector", "[benchmark][generator]")
+{
+    std::vector<std::string> const inputs = make_inputs(100'000);
+
+    CHECK(sum_values(parse_to_vector(inputs)) == sum_values(parse_lazily(inputs)));
+
+    BENCHMARK("vector<expected>, 100k")
+    {
+        return sum_values(parse_to_vector(inputs));
+    };
+    BENCHMARK("expected_generator, 100k")
+    {
+        return sum_values(parse_lazily(inputs));
+    };
+    BENCHMARK("expected_generator, stop at first error")
+    {
+        return sum_values(parse_lazily(inputs).stop_at_first_error());
+    };
+}
+
+#endif
@@ -0,0 +1,69 @@
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/histogram.hpp>
+
+namespace
+{
+
+enum class job_error : std::uint16_t
+{
+    timeout,
+    quota,
+    bad_input,
+    internal,
+};
+
+using Result = zeus::expected<std::uint64_t, job_error>;
+
+// one result in five failed, with one of four codes
+std::vector<Result> make_results(std::size_t n)
+{
+    std::vector<Result> results;
+    results.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::size_t const h = i * 2'654'435'761u % 20;
+        if (h < 4)
+            results.emplace_back(zeus::unexpect, static_cast<job_error>(h));
+        else
+            results.emplace_back(i);
+    }
+    return results;
+}
+
+} // namespace
+
+TEST_CASE("error histogram of 64K results", "[benchmark][histogram]")
+{
+    std::vector<Result> const results = make_results(65'536);
+
+    // what error_histogram() replaces
+    auto const by_map = [&results]() {
+        std::map<job_error, std::size_t> counts;
+        for (const Result &r : results)
+        {
+            if (!r.has_value())
+                ++counts[r.error()];
+        }
+        return counts;
+    };
+    CHECK(by_map()[job_error::quota] == zeus::error_histogram(results)[job_error::quota]);
+
+    BENCHMARK("std::map")
+    {
+        return by_map();
+    };
+    BENCHMARK("error_histogram")
+    {
+        return zeus::error_histogram(results);
+    };
+    BENCHMARK("error_histogram, parallel")
+    {
+        return zeus::error_histogram(zeus::parallel_policy {}, results);
+    };
+}
@@ -0,0 +1,76 @@
+#include <iostream>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+
+#include "message.hpp"
+
+namespace
+{
+
+using Result = zeus::expected<Message, int>;
+
+Message stamp(Message&& m)
+{
+    ++m.payload[0];
+    return std::move(m);
+}
+
+void stamp_inplace(Message& m)
+{
+    ++m.payload[0];
+}
+
+zeus::expected<void, int> check_inplace(Message& m)
+{
+    if (m.id < 0)
+        return zeus::unexpected(m.id);
+    return {};
+}
+
+Result check(Message&& m)
+{
+    if (m.id < 0)
+        return zeus::unexpected(m.id);
+    return Result(std::move(m));
+}
+
+Result rebuilding(Result&& r)
+{
+    return std::move(r).transform(stamp).and_then(check).transform(stamp).transform(stamp);
+}
+
+Result inplace(Result&& r)
+{
+    return std::move(r).transform_inplace(stamp_inplace).and_then_inplace(check_inplace).transform_inplace(stamp_inplace).transform_inplace(
+        stamp_inplace
+    );
+}
+
+template<class F>
+std::size_t moves_of(F&& f)
+{
+    Result r(std::in_place, 1);
+    Message::moves = 0;
+    (void) f(std::move(r));
+    return Message::moves;
+}
+
+} // namespace
+
+TEST_CASE("in-place transform vs rebuilding transform", "[benchmark][inplace]")
+{
+    std::cout << "moves of T per pipeline: rebuilding " << moves_of(rebuilding) << ", in place " << moves_of(inplace) << '\n';
+
+    Result source(std::in_place, 1);
+
+    BENCHMARK("transform()/and_then()")
+    {
+        return rebuilding(std::move(source)).has_value();
+    };
+    BENCHMARK("transform_inplace()/and_then_inplace()")
+    {
+        return inplace(std::move(source)).has_value();
+    };
+}
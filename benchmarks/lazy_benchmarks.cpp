@@ -0,0 +1,86 @@
+#include <cstddef>
+#include <iostream>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/lazy.hpp>
+
+#include "message.hpp"
+
+namespace
+{
+
+using Result = zeus::expected<Message, int>;
+
+Result validate(Message&& m)
+{
+    if (m.id < 0)
+        return zeus::unexpected(m.id);
+    return Result(std::move(m));
+}
+
+int to_code(int e)
+{
+    return e * 10;
+}
+
+Result recover(int e)
+{
+    if (e == -10)
+        return Result(std::in_place, 0);
+    return zeus::unexpected(e);
+}
+
+Message stamp(Message&& m)
+{
+    m.payload[0] = 1;
+    return std::move(m);
+}
+
+Result eager(int id)
+{
+    return Result(std::in_place, id).and_then(validate).transform_error(to_code).or_else(recover).transform(stamp);
+}
+
+Result lazy(int id)
+{
+    return zeus::lazy(Result(std::in_place, id)).and_then(validate).transform_error(to_code).or_else(recover).transform(stamp).eval();
+}
+
+template<class F>
+std::size_t moves_of(F&& f, int id)
+{
+    Message::moves = 0;
+    (void) f(id);
+    return Message::moves;
+}
+
+} // namespace
+
+TEST_CASE("lazy pipeline vs member chain", "[benchmark][lazy]")
+{
+    // The member chain tests has_value() once per stage; the lazy pipeline
+    // tests the source once and each and_then()/or_else() result it invokes.
+    std::cout << "moves of T per evaluation (success path): member chain " << moves_of(eager, 1) << ", lazy " << moves_of(lazy, 1)
+              << '\n';
+    std::cout << "moves of T per evaluation (recovered error): member chain " << moves_of(eager, -1) << ", lazy "
+              << moves_of(lazy, -1) << '\n';
+
+    BENCHMARK("member chain, success")
+    {
+        return eager(1);
+    };
+    BENCHMARK("lazy, success")
+    {
+        return lazy(1);
+    };
+    BENCHMARK("member chain, recovered error")
+    {
+        return eager(-1);
+    };
+    BENCHMARK("lazy, recovered error")
+    {
+        return lazy(-1);
+    };
+}
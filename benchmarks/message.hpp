@@ -0,0 +1,30 @@
+#ifndef ZEUS_EXPECTED_BENCHMARKS_MESSAGE_HPP
+#define ZEUS_EXPECTED_BENCHMARKS_MESSAGE_HPP
+
+#include <array>
+#include <cstddef>
+
+// A large value type counting its moves.
+struct Message
+{
+    static inline std::size_t moves = 0;
+
+    std::array<unsigned char, 4'096> payload {};
+    int                              id = 0;
+
+    explicit Message(int i)
+        : id(i)
+    {
+    }
+    Message(const Message&) = default;
+    Message(Message&& other) noexcept
+        : payload(other.payload)
+        , id(other.id)
+    {
+        ++moves;
+    }
+    Message& operator=(const Message&) = default;
+    Message& operator=(Message&&)      = default;
+};
+
+#endif
@@ -0,0 +1,64 @@
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/parallel.hpp>
+
+namespace
+{
+
+enum class math_error
+{
+    negative,
+};
+
+// enough work per element for the threads to pay off
+zeus::expected<double, math_error> slow_root(double x)
+{
+    if (x < 0)
+        return zeus::unexpected(math_error::negative);
+    double r = x;
+    for (int i = 0; i < 20; ++i)
+    {
+        r = 0.5 * (r + x / (r + 1.0));
+    }
+    return r;
+}
+
+std::vector<double> make_inputs(std::size_t n, std::size_t negative_at)
+{
+    std::vector<double> v(n);
+    std::iota(v.begin(), v.end(), 1.0);
+    if (negative_at < n)
+        v[negative_at] = -1.0;
+    return v;
+}
+
+} // namespace
+
+TEST_CASE("parallel_transform() scaling", "[benchmark][parallel]")
+{
+    std::size_t const         n     = 1'000'000;
+    std::vector<double> const clean = make_inputs(n, n);
+    std::vector<double> const early = make_inputs(n, n / 100);
+
+    CHECK(zeus::parallel_transform(zeus::parallel_policy {4}, early, slow_root) == zeus::unexpected(math_error::negative));
+
+    for (std::size_t threads : {1, 2, 4, 8, 16, 32, 64})
+    {
+        zeus::parallel_policy const policy {threads};
+
+        BENCHMARK("all values, " + std::to_string(threads) + " threads")
+        {
+            return zeus::parallel_transform(policy, clean, slow_root);
+        };
+        BENCHMARK("error at 1%, " + std::to_string(threads) + " threads")
+        {
+            return zeus::parallel_transform(policy, early, slow_root);
+        };
+    }
+}
@@ -0,0 +1,76 @@
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/partition.hpp>
+
+namespace
+{
+
+enum class fetch_error
+{
+    timeout,
+};
+
+using Result = zeus::expected<double, fetch_error>;
+
+std::vector<Result> make_results(std::size_t n)
+{
+    std::vector<Result> results;
+    results.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i % 50 == 7)
+            results.emplace_back(zeus::unexpect, fetch_error::timeout);
+        else
+            results.emplace_back(static_cast<double>(i));
+    }
+    return results;
+}
+
+// the usual loop, growing both outputs as it goes
+zeus::partitioned_results<double, fetch_error> partition_by_hand(const std::vector<Result> &results)
+{
+    zeus::partitioned_results<double, fetch_error> out;
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        if (results[i])
+        {
+            out.values.push_back(*results[i]);
+        }
+        else
+        {
+            out.error_indices.push_back(i);
+            out.errors.push_back(results[i].error());
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("partition_results() on 10M elements", "[benchmark][partition]")
+{
+    std::vector<Result> const results = make_results(10'000'000);
+
+    CHECK(zeus::partition_results(results).values == partition_by_hand(results).values);
+    CHECK(zeus::partition_results(zeus::parallel_policy {4}, results).errors == partition_by_hand(results).errors);
+
+    BENCHMARK("hand-written loop")
+    {
+        return partition_by_hand(results);
+    };
+    BENCHMARK("partition_results()")
+    {
+        return zeus::partition_results(results);
+    };
+    for (std::size_t threads : {1, 2, 4, 8, 16})
+    {
+        BENCHMARK("partition_results(), two passes, " + std::to_string(threads) + " threads")
+        {
+            return zeus::partition_results(zeus::parallel_policy {threads}, results);
+        };
+    }
+}
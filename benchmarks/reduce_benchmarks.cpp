@@ -0,0 +1,99 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/reduce.hpp>
+
+namespace
+{
+
+enum class stat_error
+{
+    unreadable,
+};
+
+struct file_stats
+{
+    std::uint64_t bytes = 0;
+    std::uint64_t lines = 0;
+    std::uint64_t files = 0;
+};
+
+using Result = zeus::expected<file_stats, stat_error>;
+
+// merging stats is cheap, so the reduction is bound by memory; a function
+// object rather than a function pointer, so that it is inlined
+struct merge
+{
+    file_stats operator()(file_stats a, const file_stats &b) const noexcept
+    {
+        a.bytes += b.bytes;
+        a.lines += b.lines;
+        a.files += b.files;
+        return a;
+    }
+};
+
+std::vector<Result> make_results(std::size_t n, std::size_t error_at)
+{
+    std::vector<Result> results;
+    results.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i == error_at)
+            results.emplace_back(zeus::unexpect, stat_error::unreadable);
+        else
+            results.push_back(file_stats {i % 4'096, i % 80, 1});
+    }
+    return results;
+}
+
+// the usual loop
+Result merge_by_hand(const std::vector<Result> &results)
+{
+    file_stats total;
+    for (const Result &r : results)
+    {
+        if (!r)
+            return zeus::unexpected(r.error());
+        total = merge {}(total, *r);
+    }
+    return total;
+}
+
+} // namespace
+
+TEST_CASE("fold() and reduce() on 10M elements", "[benchmark][reduce]")
+{
+    std::size_t const         n     = 10'000'000;
+    std::vector<Result> const clean = make_results(n, n);
+    std::vector<Result> const early = make_results(n, n / 100);
+
+    CHECK(zeus::fold(clean, file_stats {}, merge {})->files == n);
+    CHECK(zeus::reduce(zeus::parallel_policy {4}, clean, file_stats {}, merge {})->bytes == merge_by_hand(clean)->bytes);
+
+    BENCHMARK("hand-written loop")
+    {
+        return merge_by_hand(clean);
+    };
+    BENCHMARK("fold()")
+    {
+        return zeus::fold(clean, file_stats {}, merge {});
+    };
+    for (std::size_t threads : {1, 2, 4, 8, 16, 32, 64})
+    {
+        zeus::parallel_policy const policy {threads};
+
+        BENCHMARK("reduce(), all values, " + std::to_string(threads) + " threads")
+        {
+            return zeus::reduce(policy, clean, file_stats {}, merge {});
+        };
+        BENCHMARK("reduce(), error at 1%, " + std::to_string(threads) + " threads")
+        {
+            return zeus::reduce(policy, early, file_stats {}, merge {});
+        };
+    }
+}
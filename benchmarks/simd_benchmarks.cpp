@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/simd.hpp>
+
+namespace
+{
+
+template<class T, class E>
+std::vector<zeus::expected<T, E>> make_results(std::size_t n)
+{
+    std::vector<zeus::expected<T, E>> v(n);
+    // one error in 1000, and the first one near the end
+    for (std::size_t i = n / 1000; i < n; i += 1000)
+    {
+        v[i] = zeus::unexpected(E {});
+    }
+    v[n - 3] = zeus::unexpected(E {});
+    return v;
+}
+
+template<class T, class E>
+void run_benchmarks(const std::vector<zeus::expected<T, E>> &v, const char *name)
+{
+    std::vector<zeus::expected<T, E>> const clean(v.size());
+
+    auto const has_value = [](const auto &e) { return e.has_value(); };
+    CHECK(zeus::simd::count_values(v) == static_cast<std::size_t>(std::count_if(v.begin(), v.end(), has_value)));
+
+    BENCHMARK(std::string("std::count_if, ") + name)
+    {
+        return std::count_if(v.begin(), v.end(), has_value);
+    };
+    BENCHMARK(std::string("simd::count_values, ") + name)
+    {
+        return zeus::simd::count_values(v);
+    };
+    BENCHMARK(std::string("std::find_if, no error, ") + name)
+    {
+        return std::find_if(clean.begin(), clean.end(), [](const auto &e) { return !e.has_value(); });
+    };
+    BENCHMARK(std::string("simd::find_first_error, no error, ") + name)
+    {
+        return zeus::simd::find_first_error(clean);
+    };
+    std::vector<std::uint64_t> mask((v.size() + 63) / 64);
+    BENCHMARK(std::string("simd::has_value_mask, ") + name)
+    {
+        zeus::simd::has_value_mask(v, mask.data());
+        return mask[0];
+    };
+}
+
+} // namespace
+
+TEST_CASE("simd scans vs std algorithms", "[benchmark][simd]")
+{
+    std::size_t const n = 1'000'000;
+
+    run_benchmarks(make_results<std::int32_t, std::int32_t>(n), "expected<int32_t, int32_t>");
+    run_benchmarks(make_results<float, std::uint16_t>(n), "expected<float, uint16_t>");
+    run_benchmarks(make_results<double, std::int64_t>(n), "expected<double, int64_t>");
+}
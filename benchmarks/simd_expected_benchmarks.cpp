@@ -0,0 +1,92 @@
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/simd_expected.hpp>
+
+namespace
+{
+
+enum class decode_error
+{
+    out_of_range,
+};
+
+constexpr std::size_t lanes = 16;
+
+using lane_result  = zeus::expected<float, decode_error>;
+using batch_result = zeus::simd_expected<float, lanes, decode_error>;
+
+std::vector<std::int32_t> make_words(std::size_t n)
+{
+    std::vector<std::int32_t> words(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        words[i] = static_cast<std::int32_t>(i % 1'000) - (i % 97 == 0 ? 2'000 : 0);
+    }
+    return words;
+}
+
+lane_result decode(std::int32_t word)
+{
+    if (word < 0)
+        return zeus::unexpected(decode_error::out_of_range);
+    return static_cast<float>(word);
+}
+
+// one lane at a time, each wrapped in a scalar expected
+void decode_by_lane(const std::vector<std::int32_t> &words, std::vector<std::array<lane_result, lanes>> &out)
+{
+    for (std::size_t b = 0; b < out.size(); ++b)
+    {
+        for (std::size_t i = 0; i < lanes; ++i)
+        {
+            out[b][i] = decode(words[b * lanes + i]).transform([](float x) { return x * 0.5f + 1.0f; });
+        }
+    }
+}
+
+// all lanes at once, with a mask
+void decode_by_batch(const std::vector<std::int32_t> &words, std::vector<batch_result> &out)
+{
+    for (std::size_t b = 0; b < out.size(); ++b)
+    {
+        std::array<float, lanes> values;
+        std::uint64_t            mask = 0;
+        for (std::size_t i = 0; i < lanes; ++i)
+        {
+            values[i] = static_cast<float>(words[b * lanes + i]);
+            mask |= std::uint64_t {words[b * lanes + i] >= 0} << i;
+        }
+        out[b] = batch_result(values, mask, decode_error::out_of_range).transform([](float x) { return x * 0.5f + 1.0f; });
+    }
+}
+
+} // namespace
+
+TEST_CASE("simd_expected against scalar expected lanes, 16K words", "[benchmark][simd_expected]")
+{
+    std::vector<std::int32_t> const words = make_words(16'384);
+
+    std::vector<std::array<lane_result, lanes>> by_lane(words.size() / lanes);
+    std::vector<batch_result>                   by_batch(words.size() / lanes);
+
+    decode_by_lane(words, by_lane);
+    decode_by_batch(words, by_batch);
+    CHECK(by_lane[6] == by_batch[6].to_array());
+    CHECK(by_lane.back() == by_batch.back().to_array());
+
+    BENCHMARK("16 scalar expected")
+    {
+        decode_by_lane(words, by_lane);
+        return by_lane.back()[0];
+    };
+    BENCHMARK("simd_expected<float, 16>")
+    {
+        decode_by_batch(words, by_batch);
+        return by_batch.back().mask();
+    };
+}
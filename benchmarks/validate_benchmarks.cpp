@@ -0,0 +1,106 @@
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/validate.hpp>
+
+namespace
+{
+
+enum class field_error
+{
+    empty_name,
+    bad_age,
+    bad_email,
+    bad_country,
+};
+
+struct request
+{
+    std::string_view name;
+    int              age;
+    std::string_view email;
+    std::string_view country;
+};
+
+zeus::expected<std::string_view, field_error> check_name(std::string_view s)
+{
+    if (s.empty())
+        return zeus::unexpected(field_error::empty_name);
+    return s;
+}
+
+zeus::expected<int, field_error> check_age(int age)
+{
+    if (age < 0 || age > 150)
+        return zeus::unexpected(field_error::bad_age);
+    return age;
+}
+
+zeus::expected<std::string_view, field_error> check_email(std::string_view s)
+{
+    if (s.find('@') == std::string_view::npos)
+        return zeus::unexpected(field_error::bad_email);
+    return s;
+}
+
+zeus::expected<std::string_view, field_error> check_country(std::string_view s)
+{
+    if (s.size() != 2)
+        return zeus::unexpected(field_error::bad_country);
+    return s;
+}
+
+std::size_t with_error_list(const request& r)
+{
+    auto const v = zeus::validate(check_name(r.name), check_age(r.age), check_email(r.email), check_country(r.country));
+    return v.has_value() ? 0 : v.error().size();
+}
+
+std::size_t with_vector(const request& r)
+{
+    auto const name    = check_name(r.name);
+    auto const age     = check_age(r.age);
+    auto const email   = check_email(r.email);
+    auto const country = check_country(r.country);
+
+    std::vector<field_error> errors;
+    if (!name)
+        errors.push_back(name.error());
+    if (!age)
+        errors.push_back(age.error());
+    if (!email)
+        errors.push_back(email.error());
+    if (!country)
+        errors.push_back(country.error());
+    return errors.size();
+}
+
+} // namespace
+
+TEST_CASE("validate() vs collecting errors into std::vector", "[benchmark][validate]")
+{
+    request const valid {"ada", 36, "ada@example.com", "uk"};
+    request const invalid {"", 200, "ada.example.com", "uk"};
+
+    CHECK(with_error_list(invalid) == with_vector(invalid));
+
+    BENCHMARK("error_list, valid")
+    {
+        return with_error_list(valid);
+    };
+    BENCHMARK("std::vector, valid")
+    {
+        return with_vector(valid);
+    };
+    BENCHMARK("error_list, 3 errors")
+    {
+        return with_error_list(invalid);
+    };
+    BENCHMARK("std::vector, 3 errors")
+    {
+        return with_vector(invalid);
+    };
+}
@@ -0,0 +1,84 @@
+#include <zeus/expected/views.hpp>
+
+#if ZEUS_EXPECTED_HAS_RANGES
+
+    #include <algorithm>
+    #include <cstdint>
+    #include <ranges>
+    #include <string>
+    #include <vector>
+
+    #include <catch2/catch_all.hpp>
+
+    #include <zeus/expected.hpp>
+
+namespace
+{
+
+struct sample
+{
+    std::int64_t id;
+    double       weight;
+    char         label[48];
+};
+
+using Result = zeus::expected<sample, std::string>;
+
+std::vector<Result> make_results(std::size_t n)
+{
+    std::vector<Result> results;
+    results.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i % 10 == 3)
+            results.emplace_back(zeus::unexpect, "rejected");
+        else
+            results.push_back(sample {static_cast<std::int64_t>(i), static_cast<double>(i % 100), {}});
+    }
+    return results;
+}
+
+} // namespace
+
+TEST_CASE("views over 1M results", "[benchmark][views]")
+{
+    std::vector<Result> const results = make_results(1'000'000);
+
+    // what the views replace: the predicate, then a dereference that
+    // copies each value out
+    auto by_hand = results | std::views::filter([](const Result &r) { return r.has_value(); })
+                 | std::views::transform([](const Result &r) { return r.value(); });
+
+    auto const weight = [](const sample &s) { return s.weight; };
+
+    CHECK(std::ranges::distance(by_hand) == std::ranges::distance(results | zeus::views::values));
+
+    BENCHMARK("filter | transform, sum of weights")
+    {
+        double sum = 0;
+        for (const sample &s : by_hand)
+            sum += weight(s);
+        return sum;
+    };
+    BENCHMARK("views::values, sum of weights")
+    {
+        double sum = 0;
+        for (const sample &s : results | zeus::views::values)
+            sum += weight(s);
+        return sum;
+    };
+
+    std::vector<Result> clean(1'000'000, sample {1, 1.0, {}});
+    clean[900'000] = zeus::unexpected<std::string>("late");
+
+    BENCHMARK("take_while(has_value), size of the prefix")
+    {
+        return std::ranges::distance(clean | std::views::take_while([](const Result &r) { return r.has_value(); }));
+    };
+    BENCHMARK("views::take_until_error, size of the prefix")
+    {
+        return std::ranges::size(clean | zeus::views::take_until_error);
+    };
+}
+
+#endif
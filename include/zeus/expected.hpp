@@ -33,6 +33,15 @@ static_assert(false, "This expected variant requires C++17");
     #define ZEUS_EXPECTED_THROW(e) ((void) (e), std::terminate())
 #endif
 
+// Marks functions that are only called on the error path
+#if defined(__GNUC__) || defined(__clang__)
+    #define ZEUS_EXPECTED_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+    #define ZEUS_EXPECTED_COLD __declspec(noinline)
+#else
+    #define ZEUS_EXPECTED_COLD
+#endif
+
 #define ZEUS_EXPECTED_ABI_TAG expected_abi
 
 #define ZEUS_EXPECTED_NS_VERSION_CONCAT_EX(major, minor, patch) _v##major##_##minor##_##patch
@@ -402,6 +411,25 @@ constexpr void reinit_expected(First &new_val, Second &old_val, Args &&...args)
     }
 }
 
+// Invokes the fallback of value_or_else() and error_or_else(), passing
+// `args` only if `f` accepts them. Kept out of line so that the callable
+// does not bloat the hot path of the caller.
+template<class R, class F, class... Args>
+ZEUS_EXPECTED_COLD constexpr R invoke_fallback(F &&f, Args &&...args)
+{
+    if constexpr (std::is_invocable_v<F, Args...>)
+    {
+        static_assert(std::is_convertible_v<std::invoke_result_t<F, Args...>, R>, "the result of F must be convertible to the returned type");
+        return static_cast<R>(std::invoke(std::forward<F>(f), std::forward<Args>(args)...));
+    }
+    else
+    {
+        static_assert(std::is_invocable_v<F>, "F must be invocable with the alternative or without arguments");
+        static_assert(std::is_convertible_v<std::invoke_result_t<F>, R>, "the result of F must be convertible to the returned type");
+        return static_cast<R>(std::invoke(std::forward<F>(f)));
+    }
+}
+
 // Implements the storage of the values, and ensures that the destructor is
 // trivial if it can be.
 //
@@ -1436,6 +1464,26 @@ public:
     {
     }
 
+    // factories constructing the value or the error directly from the
+    // result of `std::invoke(f, args...)`, which is elided into the storage
+    // instead of being moved into it
+
+    template<class F, class... Args>
+    [[nodiscard]] static constexpr expected from_invoke(F &&f, Args &&...args) //
+        noexcept(noexcept(static_cast<T>(std::invoke(std::forward<F>(f), std::forward<Args>(args)...))))
+    {
+        static_assert(std::is_constructible_v<T, std::invoke_result_t<F, Args...>>, "T must be constructible from the result of F");
+        return expected(expected_detail::construct_with_invoke_result_t {}, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template<class F, class... Args>
+    [[nodiscard]] static constexpr expected from_error_invoke(F &&f, Args &&...args) //
+        noexcept(noexcept(static_cast<E>(std::invoke(std::forward<F>(f), std::forward<Args>(args)...))))
+    {
+        static_assert(std::is_constructible_v<E, std::invoke_result_t<F, Args...>>, "E must be constructible from the result of F");
+        return expected(expected_detail::construct_with_invoke_result_t {}, unexpect, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
     // default assignment operators
 
     constexpr expected &operator=(const expected &rhs) = default;
@@ -1777,6 +1825,120 @@ public:
         }
     }
 
+    // Like value_or(), but the default is only computed if there is no
+    // value, by invoking `f` with the error or, if it does not accept the
+    // error, without arguments.
+    template<class F>
+    constexpr T value_or_else(F &&f) &
+    {
+        static_assert(std::is_copy_constructible_v<T>, "T must be copy-constructible");
+        if (this->m_has_val)
+        {
+            return this->m_val;
+        }
+        else
+        {
+            return expected_detail::invoke_fallback<T>(std::forward<F>(f), this->m_unexpect);
+        }
+    }
+    template<class F>
+    constexpr T value_or_else(F &&f) const &
+    {
+        static_assert(std::is_copy_constructible_v<T>, "T must be copy-constructible");
+        if (this->m_has_val)
+        {
+            return this->m_val;
+        }
+        else
+        {
+            return expected_detail::invoke_fallback<T>(std::forward<F>(f), this->m_unexpect);
+        }
+    }
+    template<class F>
+    constexpr T value_or_else(F &&f) &&
+    {
+        static_assert(std::is_move_constructible_v<T>, "T must be move-constructible");
+        if (this->m_has_val)
+        {
+            return std::move(this->m_val);
+        }
+        else
+        {
+            return expected_detail::invoke_fallback<T>(std::forward<F>(f), std::move(this->m_unexpect));
+        }
+    }
+    template<class F>
+    constexpr T value_or_else(F &&f) const &&
+    {
+        // moving from a const value copies it
+        static_assert(std::is_copy_constructible_v<T>, "T must be copy-constructible");
+        if (this->m_has_val)
+        {
+            return std::move(this->m_val);
+        }
+        else
+        {
+            return expected_detail::invoke_fallback<T>(std::forward<F>(f), std::move(this->m_unexpect));
+        }
+    }
+
+    // Like error_or(), but the default is only computed if there is a
+    // value, by invoking `f` with the value or, if it does not accept the
+    // value, without arguments.
+    template<class F>
+    constexpr E error_or_else(F &&f) &
+    {
+        static_assert(std::is_copy_constructible_v<E>, "E must be copy-constructible");
+        if (this->m_has_val)
+        {
+            return expected_detail::invoke_fallback<E>(std::forward<F>(f), this->m_val);
+        }
+        else
+        {
+            return this->m_unexpect;
+        }
+    }
+    template<class F>
+    constexpr E error_or_else(F &&f) const &
+    {
+        static_assert(std::is_copy_constructible_v<E>, "E must be copy-constructible");
+        if (this->m_has_val)
+        {
+            return expected_detail::invoke_fallback<E>(std::forward<F>(f), this->m_val);
+        }
+        else
+        {
+            return this->m_unexpect;
+        }
+    }
+    template<class F>
+    constexpr E error_or_else(F &&f) &&
+    {
+        static_assert(std::is_move_constructible_v<E>, "E must be move-constructible");
+        if (this->m_has_val)
+        {
+            return expected_detail::invoke_fallback<E>(std::forward<F>(f), std::move(this->m_val));
+        }
+        else
+        {
+            return std::move(this->m_unexpect);
+        }
+    }
+    template<class F>
+    constexpr E error_or_else(F &&f) const &&
+    {
+        // moving from a const error copies it
+        static_assert(std::is_copy_constructible_v<E>, "E must be copy-constructible");
+        if (this->m_has_val)
+        {
+            return expected_detail::invoke_fallback<E>(std::forward<F>(f), std::move(this->m_val));
+        }
+        else
+        {
+            return std::move(this->m_unexpect);
+        }
+    }
+
     template<class F, class GE = E, std::enable_if_t<std::is_constructible_v<GE, GE &>> * = nullptr>
     constexpr auto and_then(F &&f) &
     {
@@ -2029,6 +2191,64 @@ public:
         }
     }
 
+    // in-place variants of transform(), and_then() and transform_error():
+    // the callable modifies the contained value or error through an lvalue
+    // reference instead of producing a new one, so no new `expected` is
+    // constructed and the current one is returned
+
+    template<class F>
+    constexpr expected &transform_inplace(F &&f) &
+    {
+        static_assert(std::is_void_v<std::invoke_result_t<F, T &>>, "F must modify the value through T& and return void");
+
+        if (has_value())
+            std::invoke(std::forward<F>(f), this->m_val);
+        return *this;
+    }
+    template<class F>
+    constexpr expected &&transform_inplace(F &&f) &&
+    {
+        return std::move(transform_inplace(std::forward<F>(f)));
+    }
+
+    template<class F>
+    constexpr expected &and_then_inplace(F &&f) &
+    {
+        using U = expected_detail::remove_cvref_t<std::invoke_result_t<F, T &>>;
+        static_assert(std::is_same_v<U, expected<void, E>>, "U (return type of F) must be expected<void, E>");
+
+        if (has_value())
+        {
+            U r = std::invoke(std::forward<F>(f), this->m_val);
+            if (!r.has_value())
+            {
+                expected_detail::reinit_expected(err(), val(), std::move(r.error()));
+                this->m_has_val = false;
+            }
+        }
+        return *this;
+    }
+    template<class F>
+    constexpr expected &&and_then_inplace(F &&f) &&
+    {
+        return std::move(and_then_inplace(std::forward<F>(f)));
+    }
+
+    template<class F>
+    constexpr expected &transform_error_inplace(F &&f) &
+    {
+        static_assert(std::is_void_v<std::invoke_result_t<F, E &>>, "F must modify the error through E& and return void");
+
+        if (!has_value())
+            std::invoke(std::forward<F>(f), err());
+        return *this;
+    }
+    template<class F>
+    constexpr expected &&transform_error_inplace(F &&f) &&
+    {
+        return std::move(transform_error_inplace(std::forward<F>(f)));
+    }
+
     template<class T2, class E2>
     [[nodiscard]] friend constexpr std::enable_if_t<!std::is_void_v<T2>, bool> operator==(const expected &x, const expected<T2, E2> &y) //
         noexcept(noexcept(*x == *y) && noexcept(x.error() == y.error()))
@@ -2055,8 +2275,12 @@ public:
     }
 #endif
 
-    template<class T2>
-    [[nodiscard]] friend constexpr bool operator==(const expected &x, const T2 &v) //
+    // `Self` keeps this overload from converting its first argument: ADL
+    // finds it for any type that mentions this expected (iterators over it,
+    // for instance), and `long == iterator` would otherwise convert `long`
+    // to this expected and recurse into `T == iterator`.
+    template<class Self, class T2, std::enable_if_t<std::is_base_of_v<expected, Self>> * = nullptr>
+    [[nodiscard]] friend constexpr bool operator==(const Self &x, const T2 &v) //
         noexcept(noexcept(*x == v))
     {
         if (x.has_value())
@@ -2069,23 +2293,23 @@ public:
         }
     }
 #if ZEUS_EXPECTED_CPLUSPLUS < 202'002L
-    template<class T2>
-    [[nodiscard]] friend constexpr bool operator!=(const expected &x, const T2 &v) //
+    template<class Self, class T2, std::enable_if_t<std::is_base_of_v<expected, Self>> * = nullptr>
+    [[nodiscard]] friend constexpr bool operator!=(const Self &x, const T2 &v) //
         noexcept(noexcept(x == v))
     {
         return !(x == v);
     }
-    template<class T2>
+    template<class T2, class Self, std::enable_if_t<std::is_base_of_v<expected, Self>> * = nullptr>
     [[nodiscard]] friend constexpr std::enable_if_t<!expected_detail::is_specialization_v<T2, zeus::expected>, bool> operator==(
-        const T2 &v, const expected &x
+        const T2 &v, const Self &x
     ) //
         noexcept(noexcept(x == v))
     {
         return x == v;
     }
-    template<class T2>
+    template<class T2, class Self, std::enable_if_t<std::is_base_of_v<expected, Self>> * = nullptr>
     [[nodiscard]] friend constexpr std::enable_if_t<!expected_detail::is_specialization_v<T2, zeus::expected>, bool> operator!=(
-        const T2 &v, const expected &x
+        const T2 &v, const Self &x
     ) //
         noexcept(noexcept(x == v))
     {
@@ -2339,6 +2563,24 @@ public:
     {
     }
 
+    // see the primary template; from_invoke() only invokes `f`
+
+    template<class F, class... Args>
+    [[nodiscard]] static constexpr expected from_invoke(F &&f, Args &&...args) //
+        noexcept(std::is_nothrow_invocable_v<F, Args...>)
+    {
+        std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+        return expected();
+    }
+
+    template<class F, class... Args>
+    [[nodiscard]] static constexpr expected from_error_invoke(F &&f, Args &&...args) //
+        noexcept(noexcept(static_cast<E>(std::invoke(std::forward<F>(f), std::forward<Args>(args)...))))
+    {
+        static_assert(std::is_constructible_v<E, std::invoke_result_t<F, Args...>>, "E must be constructible from the result of F");
+        return expected(expected_detail::construct_with_invoke_result_t {}, unexpect, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
     expected &operator=(const expected &rhs) = default;
     expected &operator=(expected &&rhs)      = default;
 
@@ -2505,6 +2747,62 @@ public:
         }
     }
 
+    // Like error_or(), but the default is only computed, by invoking `f`,
+    // if there is a value.
+    template<class F>
+    constexpr E error_or_else(F &&f) &
+    {
+        static_assert(std::is_copy_constructible_v<E>, "E must be copy-constructible");
+        if (this->m_has_val)
+        {
+            return expected_detail::invoke_fallback<E>(std::forward<F>(f));
+        }
+        else
+        {
+            return this->m_unexpect;
+        }
+    }
+    template<class F>
+    constexpr E error_or_else(F &&f) const &
+    {
+        static_assert(std::is_copy_constructible_v<E>, "E must be copy-constructible");
+        if (this->m_has_val)
+        {
+            return expected_detail::invoke_fallback<E>(std::forward<F>(f));
+        }
+        else
+        {
+            return this->m_unexpect;
+        }
+    }
+    template<class F>
+    constexpr E error_or_else(F &&f) &&
+    {
+        static_assert(std::is_move_constructible_v<E>, "E must be move-constructible");
+        if (this->m_has_val)
+        {
+            return expected_detail::invoke_fallback<E>(std::forward<F>(f));
+        }
+        else
+        {
+            return std::move(this->m_unexpect);
+        }
+    }
+    template<class F>
+    constexpr E error_or_else(F &&f) const &&
+    {
+        // moving from a const error copies it
+        static_assert(std::is_copy_constructible_v<E>, "E must be copy-constructible");
+        if (this->m_has_val)
+        {
+            return expected_detail::invoke_fallback<E>(std::forward<F>(f));
+        }
+        else
+        {
+            return std::move(this->m_unexpect);
+        }
+    }
+
     template<class F, class GE = E, std::enable_if_t<std::is_constructible_v<GE, GE &>> * = nullptr>
     constexpr auto and_then(F &&f) &
     {
@@ -2757,6 +3055,62 @@ public:
         }
     }
 
+    // in-place variants of transform(), and_then() and transform_error(),
+    // see the primary template
+
+    template<class F>
+    constexpr expected &transform_inplace(F &&f) &
+    {
+        static_assert(std::is_void_v<std::invoke_result_t<F>>, "F must return void");
+
+        if (has_value())
+            std::invoke(std::forward<F>(f));
+        return *this;
+    }
+    template<class F>
+    constexpr expected &&transform_inplace(F &&f) &&
+    {
+        return std::move(transform_inplace(std::forward<F>(f)));
+    }
+
+    template<class F>
+    constexpr expected &and_then_inplace(F &&f) &
+    {
+        using U = expected_detail::remove_cvref_t<std::invoke_result_t<F>>;
+        static_assert(std::is_same_v<U, expected>, "U (return type of F) must be expected<void, E>");
+
+        if (has_value())
+        {
+            U r = std::invoke(std::forward<F>(f));
+            if (!r.has_value())
+            {
+                expected_detail::construct_at(errptr(), std::move(r.error()));
+                this->m_has_val = false;
+            }
+        }
+        return *this;
+    }
+    template<class F>
+    constexpr expected &&and_then_inplace(F &&f) &&
+    {
+        return std::move(and_then_inplace(std::forward<F>(f)));
+    }
+
+    template<class F>
+    constexpr expected &transform_error_inplace(F &&f) &
+    {
+        static_assert(std::is_void_v<std::invoke_result_t<F, E &>>, "F must modify the error through E& and return void");
+
+        if (!has_value())
+            std::invoke(std::forward<F>(f), err());
+        return *this;
+    }
+    template<class F>
+    constexpr expected &&transform_error_inplace(F &&f) &&
+    {
+        return std::move(transform_error_inplace(std::forward<F>(f)));
+    }
+
     template<class T2, class E2>
     [[nodiscard]] friend constexpr std::enable_if_t<std::is_void_v<T2>, bool> operator==(const expected &x, const expected<T2, E2> &y) //
         noexcept(noexcept(x.error() == y.error()))
@@ -0,0 +1,170 @@
+#ifndef ZEUS_EXPECTED_BATCH_HPP
+#define ZEUS_EXPECTED_BATCH_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/collect.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+// The results of a batch function: a range of expected, or an expected
+// holding one if the whole call may fail.
+template<class R, bool = is_specialization_v<R, expected>>
+struct batch_results
+{
+    using range = R;
+};
+
+template<class R>
+struct batch_results<R, true>
+{
+    using range = typename R::value_type;
+};
+
+template<class R>
+using batch_expected_t = range_expected_t<typename batch_results<R>::range>;
+
+template<class Range>
+using range_iterator_t = decltype(std::begin(std::declval<Range &>()));
+
+template<class Range>
+inline constexpr bool is_forward_range_v =
+#if ZEUS_EXPECTED_HAS_RANGES
+    std::ranges::forward_range<Range>;
+#else
+    std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<range_iterator_t<Range>>::iterator_category>;
+#endif
+
+// Throws `std::length_error` unless the batch function returned one result
+// per value; reading them would otherwise run past the end, or drop some.
+template<class Results>
+void check_batch_size(const Results &results, std::size_t values)
+{
+    std::size_t size = 0;
+    if constexpr (is_sized_range_v<const Results>)
+    {
+        size = static_cast<std::size_t>(std::size(results));
+    }
+    else
+    {
+        size = static_cast<std::size_t>(std::distance(std::begin(results), std::end(results)));
+    }
+    if (size != values)
+    {
+        ZEUS_EXPECTED_THROW(std::length_error("batch_and_then(): the batch function must return one result per value"));
+    }
+}
+
+} // namespace expected_detail
+
+/// `and_then()` for a whole range of `expected<T, E>` at once, for
+/// functions that are much cheaper per element when called on many of
+/// them, such as a `multi_get(keys)` instead of one `get(key)` per key.
+///
+/// The values of `r` are gathered, in order, into one `std::vector<T>`, and
+/// `batch_fn` is called once with it, as an rvalue, if there is any value.
+/// It returns a sized range of `expected<U, E>` with one result per value,
+/// in the same order, or an `expected` holding such a range if the whole
+/// call may fail. The results are scattered back to the positions of
+/// their values, and the errors of `r` pass through, so the result is a
+/// `std::vector<expected<U, E>>` as long as `r`:
+///
+///     std::vector<zeus::expected<key, parse_error>> keys = parse_keys(request);
+///     auto rows = zeus::batch_and_then(keys, [&](std::vector<key> batch) { return store.multi_get(batch); });
+///
+/// If the call itself fails, every value of `r` gets its error. A range
+/// of results of another size throws `std::length_error` (or terminates
+/// without exceptions) before any result is read. `r` is read twice, so
+/// it must be a forward range. Values and errors are moved
+/// from rvalue ranges, and the results from the range `batch_fn` returns,
+/// unless its elements are const or that range is a view or a borrowed
+/// range, such as a `std::span` into a cache, which are copied from.
+template<class Range, class F, std::enable_if_t<expected_detail::is_expected_range_v<Range>> * = nullptr>
+auto batch_and_then(Range &&r, F &&batch_fn)
+{
+    using Exp = expected_detail::range_expected_t<Range>;
+    using T   = typename Exp::value_type;
+    using E   = typename Exp::error_type;
+    static_assert(!std::is_void_v<T>, "batch_and_then() requires a range of non-void values");
+    static_assert(expected_detail::is_forward_range_v<Range>, "batch_and_then() reads the range twice, so it must be a forward range");
+
+    using R       = expected_detail::remove_cvref_t<std::invoke_result_t<F &, std::vector<T> &&>>;
+    using Results = typename expected_detail::batch_results<R>::range;
+    using Out     = expected_detail::batch_expected_t<R>;
+    static_assert(expected_detail::is_specialization_v<Out, expected>, "the batch function must return a range of expected");
+    static_assert(std::is_same_v<typename Out::error_type, E>, "the batch function must fail with the error type of the range");
+
+    std::vector<T> values;
+    if constexpr (expected_detail::is_sized_range_v<Range>)
+    {
+        values.reserve(static_cast<std::size_t>(std::size(r)));
+    }
+    std::size_t size = 0;
+    for (auto &&e : r)
+    {
+        if (e.has_value())
+        {
+            values.push_back(*expected_detail::forward_element<Range>(e));
+        }
+        ++size;
+    }
+
+    std::vector<Out> out;
+    out.reserve(size);
+
+    // second pass: the errors of `r` pass through and every value is
+    // replaced with `next_result()`
+    auto const scatter = [&r, &out](auto &&next_result) {
+        for (auto &&e : r)
+        {
+            if (e.has_value())
+                out.push_back(next_result());
+            else
+                out.emplace_back(unexpect, expected_detail::forward_element<Range>(e).error());
+        }
+    };
+
+    if (values.empty())
+    {
+        for (auto &&e : r)
+        {
+            out.emplace_back(unexpect, expected_detail::forward_element<Range>(e).error());
+        }
+        return out;
+    }
+
+    std::size_t const count   = values.size();
+    R                 results = std::invoke(batch_fn, std::move(values));
+    if constexpr (expected_detail::is_specialization_v<R, expected>)
+    {
+        if (!results.has_value())
+        {
+            scatter([&results]() { return Out(unexpect, results.error()); });
+            return out;
+        }
+        expected_detail::check_batch_size(*results, count);
+        auto it = std::begin(*results);
+        scatter([&it]() { return Out(expected_detail::forward_element<Results>(*it++)); });
+    }
+    else
+    {
+        expected_detail::check_batch_size(results, count);
+        auto it = std::begin(results);
+        scatter([&it]() { return Out(expected_detail::forward_element<Results>(*it++)); });
+    }
+    return out;
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
@@ -0,0 +1,559 @@
+#ifndef ZEUS_EXPECTED_CHECKED_HPP
+#define ZEUS_EXPECTED_CHECKED_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/simd.hpp>
+
+// The block loops are plain C++ that the compiler vectorizes. GCC and Clang
+// can also compile them for AVX2 through a target attribute, selected at
+// run time; MSVC cannot, so it only has the baseline loops.
+#if ZEUS_EXPECTED_SIMD && !(defined(_MSC_VER) && !defined(__clang__))
+    #define ZEUS_EXPECTED_CHECKED_AVX2 1
+#else
+    #define ZEUS_EXPECTED_CHECKED_AVX2 0
+#endif
+
+ZEUS_EXPECTED_NS_BEGIN
+
+/// Why an integer operation failed: its exact result is greater than the
+/// largest value of the result type, or less than its smallest value.
+enum class overflow_error
+{
+    overflow,
+    underflow,
+};
+
+/// The error of the span-level checked operations: the index of the first
+/// element whose result does not fit, and in which direction.
+struct first_overflow_index
+{
+    std::size_t    index;
+    overflow_error error;
+
+    friend constexpr bool operator==(const first_overflow_index &x, const first_overflow_index &y) noexcept
+    {
+        return x.index == y.index && x.error == y.error;
+    }
+    friend constexpr bool operator!=(const first_overflow_index &x, const first_overflow_index &y) noexcept { return !(x == y); }
+};
+
+namespace expected_detail
+{
+
+template<class T>
+inline constexpr bool is_checked_integer_v = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+// The arithmetic of the checked operations: each stores the wrapped result
+// in `r` and returns true if it differs from the exact one.
+template<class T>
+constexpr bool add_overflows(T a, T b, T &r) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_add_overflow(a, b, &r);
+#else
+    using U = std::make_unsigned_t<T>;
+    U const w = static_cast<U>(static_cast<U>(a) + static_cast<U>(b));
+    r         = static_cast<T>(w);
+    if constexpr (std::is_signed_v<T>)
+    {
+        return ((static_cast<U>(a) ^ w) & (static_cast<U>(b) ^ w)) >> std::numeric_limits<T>::digits != 0;
+    }
+    else
+    {
+        return w < a;
+    }
+#endif
+}
+
+template<class T>
+constexpr bool sub_overflows(T a, T b, T &r) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_sub_overflow(a, b, &r);
+#else
+    using U = std::make_unsigned_t<T>;
+    U const w = static_cast<U>(static_cast<U>(a) - static_cast<U>(b));
+    r         = static_cast<T>(w);
+    if constexpr (std::is_signed_v<T>)
+    {
+        return ((static_cast<U>(a) ^ static_cast<U>(b)) & (static_cast<U>(a) ^ w)) >> std::numeric_limits<T>::digits != 0;
+    }
+    else
+    {
+        return a < b;
+    }
+#endif
+}
+
+template<class T>
+constexpr bool mul_overflows(T a, T b, T &r) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_mul_overflow(a, b, &r);
+#else
+    // types narrower than unsigned int would be promoted to int, whose
+    // multiplication may overflow
+    using U        = std::make_unsigned_t<T>;
+    using W        = std::conditional_t<(sizeof(U) < sizeof(unsigned)), unsigned, U>;
+    constexpr T lo = std::numeric_limits<T>::min();
+    constexpr T hi = std::numeric_limits<T>::max();
+    r              = static_cast<T>(static_cast<U>(static_cast<W>(static_cast<U>(a)) * static_cast<W>(static_cast<U>(b))));
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (a > 0)
+            return b > 0 ? a > hi / b : b < lo / a;
+        return b > 0 ? a < lo / b : a != 0 && b < hi / a;
+    }
+    else
+    {
+        return a != 0 && b > hi / a;
+    }
+#endif
+}
+
+// The direction of an overflow, from the signs of the operands.
+template<class T>
+constexpr overflow_error add_overflow_direction(T, T b) noexcept
+{
+    return b < T {0} ? overflow_error::underflow : overflow_error::overflow;
+}
+
+template<class T>
+constexpr overflow_error sub_overflow_direction(T, T b) noexcept
+{
+    if constexpr (std::is_signed_v<T>)
+    {
+        return b < T {0} ? overflow_error::overflow : overflow_error::underflow;
+    }
+    else
+    {
+        return overflow_error::underflow;
+    }
+}
+
+template<class T>
+constexpr overflow_error mul_overflow_direction(T a, T b) noexcept
+{
+    return (a < T {0}) != (b < T {0}) ? overflow_error::underflow : overflow_error::overflow;
+}
+
+// Whether `v` is below the smallest or above the largest value of `To`.
+// Either test compiles to a single comparison, or to nothing.
+template<class To, class From>
+constexpr bool below_min(From v) noexcept
+{
+    if constexpr (std::is_signed_v<From> && !std::is_signed_v<To>)
+    {
+        return v < From {0};
+    }
+    else if constexpr (std::is_signed_v<From> && std::numeric_limits<To>::digits < std::numeric_limits<From>::digits)
+    {
+        return v < static_cast<From>(std::numeric_limits<To>::min());
+    }
+    else
+    {
+        (void) v;
+        return false;
+    }
+}
+
+template<class To, class From>
+constexpr bool above_max(From v) noexcept
+{
+    if constexpr (std::numeric_limits<To>::digits < std::numeric_limits<From>::digits)
+    {
+        return v > static_cast<From>(std::numeric_limits<To>::max());
+    }
+    else
+    {
+        (void) v;
+        return false;
+    }
+}
+
+} // namespace expected_detail
+
+/// `a + b`, or the direction in which it does not fit in `T`.
+///
+///     zeus::expected<std::int64_t, zeus::overflow_error> total = zeus::checked_add(balance, deposit);
+template<class T, std::enable_if_t<expected_detail::is_checked_integer_v<T>> * = nullptr>
+constexpr expected<T, overflow_error> checked_add(T a, T b) noexcept
+{
+    T r {};
+    if (expected_detail::add_overflows(a, b, r))
+    {
+        return expected<T, overflow_error>(unexpect, expected_detail::add_overflow_direction(a, b));
+    }
+    return r;
+}
+
+/// `a - b`, or the direction in which it does not fit in `T`.
+template<class T, std::enable_if_t<expected_detail::is_checked_integer_v<T>> * = nullptr>
+constexpr expected<T, overflow_error> checked_sub(T a, T b) noexcept
+{
+    T r {};
+    if (expected_detail::sub_overflows(a, b, r))
+    {
+        return expected<T, overflow_error>(unexpect, expected_detail::sub_overflow_direction(a, b));
+    }
+    return r;
+}
+
+/// `a * b`, or the direction in which it does not fit in `T`.
+template<class T, std::enable_if_t<expected_detail::is_checked_integer_v<T>> * = nullptr>
+constexpr expected<T, overflow_error> checked_mul(T a, T b) noexcept
+{
+    T r {};
+    if (expected_detail::mul_overflows(a, b, r))
+    {
+        return expected<T, overflow_error>(unexpect, expected_detail::mul_overflow_direction(a, b));
+    }
+    return r;
+}
+
+/// `v` converted to the integer type `To`, or the direction in which it
+/// does not fit, whatever the signedness of both types.
+///
+///     zeus::expected<std::uint16_t, zeus::overflow_error> port = zeus::checked_narrow<std::uint16_t>(parsed);
+template<
+    class To,
+    class From,
+    std::enable_if_t<expected_detail::is_checked_integer_v<To> && expected_detail::is_checked_integer_v<From>> * = nullptr>
+constexpr expected<To, overflow_error> checked_narrow(From v) noexcept
+{
+    if (expected_detail::below_min<To>(v))
+    {
+        return expected<To, overflow_error>(unexpect, overflow_error::underflow);
+    }
+    if (expected_detail::above_max<To>(v))
+    {
+        return expected<To, overflow_error>(unexpect, overflow_error::overflow);
+    }
+    return static_cast<To>(v);
+}
+
+namespace expected_detail
+{
+
+namespace checked_kernels
+{
+
+// The span-level operations work in blocks: the results of a block are
+// computed with wrapping arithmetic into a local array, along with an
+// overflow flag per element that is or-ed into one word. Both loops are
+// free of branches and of stores that may alias the operands, so the
+// compiler can vectorize them; there are no hand-written intrinsics. The
+// block is written out only if no flag is set.
+inline constexpr std::size_t block_size = 64;
+
+template<class T>
+using wide_product_t = std::conditional_t<
+    std::is_signed_v<T>,
+    std::conditional_t<sizeof(T) <= 2, std::int32_t, std::int64_t>,
+    std::conditional_t<sizeof(T) <= 2, std::uint32_t, std::uint64_t>>;
+
+// Each operation: the wrapped result and its overflow flag, 0 or 1, with
+// arithmetic that vector units have; and the checked scalar operation,
+// used to find the first overflow of a block and for the remainder.
+template<class T>
+struct add_op
+{
+    using U = std::make_unsigned_t<T>;
+
+    static U apply(T a, T b, T &r) noexcept
+    {
+        U const w = static_cast<U>(static_cast<U>(a) + static_cast<U>(b));
+        r         = static_cast<T>(w);
+        if constexpr (std::is_signed_v<T>)
+        {
+            return static_cast<U>(((static_cast<U>(a) ^ w) & (static_cast<U>(b) ^ w)) >> std::numeric_limits<T>::digits);
+        }
+        else
+        {
+            return static_cast<U>(w < a);
+        }
+    }
+
+    static constexpr expected<T, overflow_error> checked(T a, T b) noexcept { return checked_add(a, b); }
+};
+
+template<class T>
+struct sub_op
+{
+    using U = std::make_unsigned_t<T>;
+
+    static U apply(T a, T b, T &r) noexcept
+    {
+        U const w = static_cast<U>(static_cast<U>(a) - static_cast<U>(b));
+        r         = static_cast<T>(w);
+        if constexpr (std::is_signed_v<T>)
+        {
+            return static_cast<U>(((static_cast<U>(a) ^ static_cast<U>(b)) & (static_cast<U>(a) ^ w)) >> std::numeric_limits<T>::digits);
+        }
+        else
+        {
+            return static_cast<U>(a < b);
+        }
+    }
+
+    static constexpr expected<T, overflow_error> checked(T a, T b) noexcept { return checked_sub(a, b); }
+};
+
+// Products up to 32 bits are computed exactly in 64 bits; vector units
+// have no 64-bit multiplication with a high half, so 64-bit products
+// use the scalar overflow test.
+template<class T>
+struct mul_op
+{
+    using U = std::make_unsigned_t<T>;
+    using W = wide_product_t<T>;
+
+    static U apply(T a, T b, T &r) noexcept
+    {
+        if constexpr (sizeof(T) < sizeof(W))
+        {
+            W const w = static_cast<W>(static_cast<W>(a) * static_cast<W>(b));
+            r         = static_cast<T>(w);
+            return static_cast<U>(static_cast<W>(r) != w);
+        }
+        else
+        {
+            return static_cast<U>(mul_overflows(a, b, r));
+        }
+    }
+
+    static constexpr expected<T, overflow_error> checked(T a, T b) noexcept { return checked_mul(a, b); }
+};
+
+// Number of leading elements in blocks free of overflow, whose results
+// are written to `out`.
+template<class Op, class T>
+inline std::size_t binary_blocks(const T *a, const T *b, T *out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + block_size <= n; i += block_size)
+    {
+        T              r[block_size];
+        typename Op::U flags = 0;
+        for (std::size_t j = 0; j < block_size; ++j)
+        {
+            flags |= Op::apply(a[i + j], b[i + j], r[j]);
+        }
+        if (flags != 0)
+        {
+            break;
+        }
+        std::memcpy(out + i, r, sizeof(r));
+    }
+    return i;
+}
+
+template<class To, class From>
+inline std::size_t narrow_blocks(const From *in, To *out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + block_size <= n; i += block_size)
+    {
+        To                         r[block_size];
+        std::make_unsigned_t<From> flags = 0;
+        for (std::size_t j = 0; j < block_size; ++j)
+        {
+            From const v = in[i + j];
+            r[j]         = static_cast<To>(v);
+            flags |= static_cast<std::make_unsigned_t<From>>(below_min<To>(v) | above_max<To>(v));
+        }
+        if (flags != 0)
+        {
+            break;
+        }
+        std::memcpy(out + i, r, sizeof(r));
+    }
+    return i;
+}
+
+#if ZEUS_EXPECTED_CHECKED_AVX2
+
+// the same loops, inlined into functions the compiler may vectorize with
+// AVX2 instructions
+template<class Op, class T>
+ZEUS_EXPECTED_TARGET_AVX2 std::size_t binary_blocks_avx2(const T *a, const T *b, T *out, std::size_t n) noexcept
+{
+    return binary_blocks<Op>(a, b, out, n);
+}
+
+template<class To, class From>
+ZEUS_EXPECTED_TARGET_AVX2 std::size_t narrow_blocks_avx2(const From *in, To *out, std::size_t n) noexcept
+{
+    return narrow_blocks(in, out, n);
+}
+
+#endif
+
+template<class Op, class T>
+expected<void, first_overflow_index> checked_binary(const T *a, const T *b, T *out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+#if ZEUS_EXPECTED_CHECKED_AVX2
+    if (simd_kernels::use_avx2())
+        i = binary_blocks_avx2<Op>(a, b, out, n);
+    else
+        i = binary_blocks<Op>(a, b, out, n);
+#else
+    i = binary_blocks<Op>(a, b, out, n);
+#endif
+    for (; i < n; ++i)
+    {
+        auto const r = Op::checked(a[i], b[i]);
+        if (!r.has_value())
+        {
+            return expected<void, first_overflow_index>(unexpect, first_overflow_index {i, r.error()});
+        }
+        out[i] = *r;
+    }
+    return {};
+}
+
+template<class To, class From>
+expected<void, first_overflow_index> checked_convert(const From *in, To *out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+#if ZEUS_EXPECTED_CHECKED_AVX2
+    if (simd_kernels::use_avx2())
+        i = narrow_blocks_avx2(in, out, n);
+    else
+        i = narrow_blocks(in, out, n);
+#else
+    i = narrow_blocks(in, out, n);
+#endif
+    for (; i < n; ++i)
+    {
+        auto const r = checked_narrow<To>(in[i]);
+        if (!r.has_value())
+        {
+            return expected<void, first_overflow_index>(unexpect, first_overflow_index {i, r.error()});
+        }
+        out[i] = *r;
+    }
+    return {};
+}
+
+} // namespace checked_kernels
+
+template<class Range>
+using contiguous_integer_t = std::remove_pointer_t<decltype(std::data(std::declval<Range &>()))>;
+
+template<class Range, class = void>
+inline constexpr bool is_contiguous_integer_range_v = false;
+template<class Range>
+inline constexpr bool
+    is_contiguous_integer_range_v<Range, std::void_t<contiguous_integer_t<Range>, decltype(std::size(std::declval<Range &>()))>> =
+        is_checked_integer_v<std::remove_cv_t<contiguous_integer_t<Range>>>;
+
+} // namespace expected_detail
+
+namespace simd
+{
+
+/// `out[i] = a[i] + b[i]` for every `i < n`, or the first index at which
+/// the sum does not fit in `T`. The sums are checked a block at a time,
+/// in branch-free loops left for the compiler to vectorize (also for
+/// AVX2 with GCC and Clang, selected at run time), then the block holding
+/// the overflow is checked again element by element. On failure, `out[i]` holds its sum
+/// for every `i` before the index and the rest of `out` is unchanged.
+/// `out` may be `a` or `b` but must not overlap them otherwise.
+///
+///     if (auto r = zeus::simd::checked_add(balances, deposits, balances); !r)
+///         reject(r.error().index, r.error().error);
+template<class T, std::enable_if_t<expected_detail::is_checked_integer_v<T>> * = nullptr>
+expected<void, first_overflow_index> checked_add(const T *a, const T *b, T *out, std::size_t n) noexcept
+{
+    return expected_detail::checked_kernels::checked_binary<expected_detail::checked_kernels::add_op<T>>(a, b, out, n);
+}
+
+/// `out[i] = a[i] - b[i]`, as `checked_add()`.
+template<class T, std::enable_if_t<expected_detail::is_checked_integer_v<T>> * = nullptr>
+expected<void, first_overflow_index> checked_sub(const T *a, const T *b, T *out, std::size_t n) noexcept
+{
+    return expected_detail::checked_kernels::checked_binary<expected_detail::checked_kernels::sub_op<T>>(a, b, out, n);
+}
+
+/// `out[i] = a[i] * b[i]`, as `checked_add()`. Only products of up to 32
+/// bits are checked in vectorizable loops.
+template<class T, std::enable_if_t<expected_detail::is_checked_integer_v<T>> * = nullptr>
+expected<void, first_overflow_index> checked_mul(const T *a, const T *b, T *out, std::size_t n) noexcept
+{
+    return expected_detail::checked_kernels::checked_binary<expected_detail::checked_kernels::mul_op<T>>(a, b, out, n);
+}
+
+/// `out[i] = in[i]` converted to `To` for every `i < n`, or the first index
+/// at which the value does not fit, as `checked_add()`. `out` must not
+/// overlap `in`.
+template<
+    class To,
+    class From,
+    std::enable_if_t<expected_detail::is_checked_integer_v<To> && expected_detail::is_checked_integer_v<From>> * = nullptr>
+expected<void, first_overflow_index> checked_narrow(const From *in, To *out, std::size_t n) noexcept
+{
+    return expected_detail::checked_kernels::checked_convert(in, out, n);
+}
+
+/// The same operations over contiguous ranges of integers, such as
+/// `std::vector` or `std::array`, of `std::size(a)` elements. `b` and
+/// `out` must be at least as long as `a`.
+template<
+    class A,
+    class B,
+    class Out,
+    std::enable_if_t<expected_detail::is_contiguous_integer_range_v<const A> && expected_detail::is_contiguous_integer_range_v<const B>
+                     && expected_detail::is_contiguous_integer_range_v<Out>> * = nullptr>
+expected<void, first_overflow_index> checked_add(const A &a, const B &b, Out &&out) noexcept
+{
+    return checked_add(std::data(a), std::data(b), std::data(out), static_cast<std::size_t>(std::size(a)));
+}
+
+template<
+    class A,
+    class B,
+    class Out,
+    std::enable_if_t<expected_detail::is_contiguous_integer_range_v<const A> && expected_detail::is_contiguous_integer_range_v<const B>
+                     && expected_detail::is_contiguous_integer_range_v<Out>> * = nullptr>
+expected<void, first_overflow_index> checked_sub(const A &a, const B &b, Out &&out) noexcept
+{
+    return checked_sub(std::data(a), std::data(b), std::data(out), static_cast<std::size_t>(std::size(a)));
+}
+
+template<
+    class A,
+    class B,
+    class Out,
+    std::enable_if_t<expected_detail::is_contiguous_integer_range_v<const A> && expected_detail::is_contiguous_integer_range_v<const B>
+                     && expected_detail::is_contiguous_integer_range_v<Out>> * = nullptr>
+expected<void, first_overflow_index> checked_mul(const A &a, const B &b, Out &&out) noexcept
+{
+    return checked_mul(std::data(a), std::data(b), std::data(out), static_cast<std::size_t>(std::size(a)));
+}
+
+/// `checked_narrow()` of a contiguous range into another, of at least
+/// `std::size(in)` elements, whose element type is the target type.
+template<
+    class In,
+    class Out,
+    std::enable_if_t<expected_detail::is_contiguous_integer_range_v<const In>
+                     && expected_detail::is_contiguous_integer_range_v<Out>> * = nullptr>
+expected<void, first_overflow_index> checked_narrow(const In &in, Out &&out) noexcept
+{
+    return checked_narrow(std::data(in), std::data(out), static_cast<std::size_t>(std::size(in)));
+}
+
+} // namespace simd
+
+ZEUS_EXPECTED_NS_END
+
+#endif
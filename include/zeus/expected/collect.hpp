@@ -0,0 +1,148 @@
+#ifndef ZEUS_EXPECTED_COLLECT_HPP
+#define ZEUS_EXPECTED_COLLECT_HPP
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <zeus/expected.hpp>
+
+#if ZEUS_EXPECTED_CPLUSPLUS >= 202'002L && __has_include(<ranges>)
+    #include <ranges>
+#endif
+
+#ifndef ZEUS_EXPECTED_HAS_RANGES
+    #if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201'911L
+        #define ZEUS_EXPECTED_HAS_RANGES 1
+    #else
+        #define ZEUS_EXPECTED_HAS_RANGES 0
+    #endif
+#endif
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+template<class Range>
+using range_reference_t = decltype(*std::begin(std::declval<Range &>()));
+
+// the `expected` specialization a range of expected holds
+template<class Range>
+using range_expected_t = remove_cvref_t<range_reference_t<Range>>;
+
+template<class Range, class = void>
+inline constexpr bool is_sized_range_v = false;
+template<class Range>
+inline constexpr bool is_sized_range_v<Range, std::void_t<decltype(std::size(std::declval<Range &>()))>> = true;
+
+template<class Container, class = void>
+inline constexpr bool has_reserve_v = false;
+template<class Container>
+inline constexpr bool has_reserve_v<Container, std::void_t<decltype(std::declval<Container &>().reserve(std::size_t {}))>> = true;
+
+// Whether an rvalue `Range` owns its elements. Views and borrowed ranges
+// such as `std::span` refer to elements of another range, so they must
+// not be moved from; without <ranges>, every rvalue range is taken to own
+// its elements.
+template<class Range>
+inline constexpr bool owns_elements_v =
+#if ZEUS_EXPECTED_HAS_RANGES
+    !std::ranges::view<remove_cvref_t<Range>> && !std::ranges::borrowed_range<Range>;
+#else
+    true;
+#endif
+
+// Forwards an element of a range as an rvalue if the range itself is an
+// rvalue owning its elements, so that values and errors are moved out of
+// it.
+template<class Range, class Ref>
+constexpr decltype(auto) forward_element(Ref &&element) noexcept
+{
+    if constexpr (std::is_lvalue_reference_v<Range> || !owns_elements_v<Range> || !std::is_lvalue_reference_v<Ref>)
+    {
+        return std::forward<Ref>(element);
+    }
+    else
+    {
+        return std::move(element);
+    }
+}
+
+template<class Range>
+inline constexpr bool is_expected_range_v = is_specialization_v<range_expected_t<Range>, expected>;
+
+// Appends the values of `r` to `out` (or only checks them if `Out` is
+// void) and stops at the first error.
+template<class Range, class Out>
+expected<void, typename range_expected_t<Range>::error_type> collect_values(Range &&r, Out *out)
+{
+    using E = typename range_expected_t<Range>::error_type;
+
+    if constexpr (!std::is_void_v<Out> && is_sized_range_v<Range> && has_reserve_v<Out>)
+    {
+        out->reserve(out->size() + static_cast<std::size_t>(std::size(r)));
+    }
+    for (auto &&e : r)
+    {
+        if (!e.has_value())
+        {
+            return expected<void, E>(unexpect, forward_element<Range>(e).error());
+        }
+        if constexpr (!std::is_void_v<Out>)
+        {
+            out->push_back(*forward_element<Range>(e));
+        }
+    }
+    return {};
+}
+
+} // namespace expected_detail
+
+/// Appends the values of a range of `expected<T, E>` to `out` until the
+/// first error, which is returned; the elements after it are not touched
+/// and the values before it stay in `out`. `out` is reserved for the whole
+/// range if its size is known, and values and errors are moved from
+/// rvalue ranges.
+template<class Range, class Out, std::enable_if_t<expected_detail::is_expected_range_v<Range>> * = nullptr>
+auto collect_into(Range &&r, Out &out)
+{
+    static_assert(
+        !std::is_void_v<typename expected_detail::range_expected_t<Range>::value_type>, "collect_into() requires a range of non-void values"
+    );
+    return expected_detail::collect_values(std::forward<Range>(r), std::addressof(out));
+}
+
+/// Turns a range of `expected<T, E>` into `expected<std::vector<T>, E>`
+/// holding either all values or the first error, see `collect_into()`. A
+/// range of `expected<void, E>` gives an `expected<void, E>`.
+template<class Range, std::enable_if_t<expected_detail::is_expected_range_v<Range>> * = nullptr>
+auto collect(Range &&r)
+{
+    using Exp = expected_detail::range_expected_t<Range>;
+    using T   = typename Exp::value_type;
+    using E   = typename Exp::error_type;
+
+    if constexpr (std::is_void_v<T>)
+    {
+        return expected_detail::collect_values(std::forward<Range>(r), static_cast<void *>(nullptr));
+    }
+    else
+    {
+        using Result = expected<std::vector<T>, E>;
+
+        std::vector<T>    values;
+        expected<void, E> status = expected_detail::collect_values(std::forward<Range>(r), std::addressof(values));
+        if (!status.has_value())
+        {
+            return Result(unexpect, std::move(status).error());
+        }
+        return Result(std::in_place, std::move(values));
+    }
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
@@ -0,0 +1,355 @@
+#ifndef ZEUS_EXPECTED_CONTEXT_HPP
+#define ZEUS_EXPECTED_CONTEXT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <string_view>
+#include <utility>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/pipe.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+struct context_chunk;
+
+// One context message, stored in the arena right after this header.
+// `refs` counts the context_error objects and the newer frames referring
+// to the frame.
+struct context_frame
+{
+    const context_frame             *next;
+    context_chunk                   *chunk;
+    std::size_t                      size;
+    mutable std::atomic<std::size_t> refs;
+
+    std::string_view message() const noexcept { return {reinterpret_cast<const char *>(this + 1), size}; }
+};
+
+// `live` counts the frames of the chunk still referred to, plus one while
+// an arena adds frames to it.
+struct context_chunk
+{
+    std::size_t              capacity;
+    std::atomic<std::size_t> live;
+};
+
+// Per-thread bump allocator for context frames. Frames and chunks are
+// reference counted atomically, so a context_error may be copied, moved
+// and destroyed on any thread, and may outlive the thread that added its
+// messages: a chunk is freed by whichever thread releases its last frame,
+// and the current chunk is rewound once only the arena refers to it. A
+// long-lived error thus only keeps the chunks holding its own messages,
+// and a thread that has warmed up no longer allocates.
+class context_arena
+{
+public:
+    static constexpr std::size_t chunk_size = 4096;
+
+    context_arena() = default;
+
+    context_arena(const context_arena &)            = delete;
+    context_arena &operator=(const context_arena &) = delete;
+
+    ~context_arena()
+    {
+        if (m_current)
+        {
+            release_chunk(m_current);
+        }
+    }
+
+    static context_arena &local() noexcept
+    {
+        thread_local context_arena arena;
+        return arena;
+    }
+
+    /// Number of chunks allocated so far.
+    std::size_t chunks() const noexcept { return m_chunks; }
+
+    // Adds a frame in front of `next`, taking over the reference the
+    // caller held to it.
+    const context_frame *push(const context_frame *next, std::string_view message)
+    {
+        std::size_t const bytes = round_up(sizeof(context_frame) + message.size());
+        if (m_current && m_current->live.load(std::memory_order_acquire) == 1)
+        {
+            m_used = 0;
+        }
+        if (!m_current || m_current->capacity - m_used < bytes)
+        {
+            next_chunk(bytes);
+        }
+        void *p = reinterpret_cast<unsigned char *>(m_current + 1) + m_used;
+        m_used += bytes;
+        m_current->live.fetch_add(1, std::memory_order_relaxed);
+
+        auto *frame = ::new (p) context_frame {next, m_current, message.size(), {1}};
+        if (!message.empty())
+        {
+            std::memcpy(reinterpret_cast<char *>(frame + 1), message.data(), message.size());
+        }
+        return frame;
+    }
+
+    static void retain(const context_frame *frame) noexcept
+    {
+        if (frame)
+        {
+            frame->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    static void release(const context_frame *frame) noexcept
+    {
+        while (frame && frame->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            context_chunk *c = frame->chunk;
+            frame            = frame->next;
+            release_chunk(c);
+        }
+    }
+
+private:
+    static constexpr std::size_t round_up(std::size_t n) noexcept
+    {
+        return (n + alignof(context_frame) - 1) / alignof(context_frame) * alignof(context_frame);
+    }
+
+    static void release_chunk(context_chunk *c) noexcept
+    {
+        if (c->live.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            c->~context_chunk();
+            ::operator delete(c);
+        }
+    }
+
+    // moves to a new chunk large enough for `bytes`; the current one is
+    // freed once its frames are released
+    void next_chunk(std::size_t bytes)
+    {
+        std::size_t const capacity = bytes > chunk_size ? bytes : chunk_size;
+        auto             *fresh    = ::new (::operator new(sizeof(context_chunk) + capacity)) context_chunk {capacity, {1}};
+        ++m_chunks;
+        if (m_current)
+        {
+            release_chunk(m_current);
+        }
+        m_current = fresh;
+        m_used    = 0;
+    }
+
+    context_chunk *m_current = nullptr;
+    std::size_t    m_used    = 0;
+    std::size_t    m_chunks  = 0;
+};
+
+} // namespace expected_detail
+
+/// An error of type `E` together with a chain of context messages such as
+/// "while loading shard 12", added by each layer the error goes through:
+///
+///     zeus::expected<shard, zeus::context_error<io_error>> load_shard(int id)
+///     {
+///         return read_file(path_of(id)) | zeus::with_context("while loading shard");
+///     }
+///
+/// Messages are copied into a bump arena of the current thread instead of
+/// being concatenated into strings, and the memory of a chain is reclaimed
+/// once no `context_error` refers to it, whichever thread releases it
+/// last. Errors may therefore be handed to other threads, as the parallel
+/// algorithms do, and may outlive the thread that added their context.
+/// Copies share the messages already added; adding context to one copy
+/// does not change the others.
+template<class E>
+class context_error
+{
+    static_assert(expected_detail::is_error_type_valid_v<E>, "E must be a valid error type");
+
+public:
+    using error_type = E;
+
+    /// Forward range over the context messages, the most recently added
+    /// (outermost) first.
+    class context_range
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = std::string_view;
+            using reference         = std::string_view;
+            using pointer           = void;
+
+            iterator() noexcept = default;
+
+            std::string_view operator*() const noexcept { return m_frame->message(); }
+
+            iterator &operator++() noexcept
+            {
+                m_frame = m_frame->next;
+                return *this;
+            }
+            iterator operator++(int) noexcept
+            {
+                iterator it = *this;
+                ++*this;
+                return it;
+            }
+
+            friend bool operator==(iterator lhs, iterator rhs) noexcept { return lhs.m_frame == rhs.m_frame; }
+            friend bool operator!=(iterator lhs, iterator rhs) noexcept { return lhs.m_frame != rhs.m_frame; }
+
+        private:
+            friend class context_range;
+
+            explicit iterator(const expected_detail::context_frame *frame) noexcept
+                : m_frame(frame)
+            {
+            }
+
+            const expected_detail::context_frame *m_frame = nullptr;
+        };
+
+        iterator begin() const noexcept { return iterator(m_head); }
+        iterator end() const noexcept { return iterator(); }
+        bool     empty() const noexcept { return m_head == nullptr; }
+
+    private:
+        friend class context_error;
+
+        explicit context_range(const expected_detail::context_frame *head) noexcept
+            : m_head(head)
+        {
+        }
+
+        const expected_detail::context_frame *m_head;
+    };
+
+    template<
+        class G = E,
+        std::enable_if_t<!std::is_same_v<expected_detail::remove_cvref_t<G>, context_error> && std::is_constructible_v<E, G>> * = nullptr>
+    constexpr context_error(G &&e) noexcept(std::is_nothrow_constructible_v<E, G>)
+        : m_error(std::forward<G>(e))
+    {
+    }
+
+    context_error(const context_error &rhs) noexcept(std::is_nothrow_copy_constructible_v<E>)
+        : m_error(rhs.m_error)
+        , m_head(rhs.m_head)
+    {
+        expected_detail::context_arena::retain(m_head);
+    }
+
+    context_error(context_error &&rhs) noexcept(std::is_nothrow_move_constructible_v<E>)
+        : m_error(std::move(rhs.m_error))
+        , m_head(std::exchange(rhs.m_head, nullptr))
+    {
+    }
+
+    context_error &operator=(const context_error &rhs) noexcept(std::is_nothrow_copy_assignable_v<E>)
+    {
+        if (this != &rhs)
+        {
+            m_error = rhs.m_error;
+            expected_detail::context_arena::retain(rhs.m_head);
+            release();
+            m_head = rhs.m_head;
+        }
+        return *this;
+    }
+
+    context_error &operator=(context_error &&rhs) noexcept(std::is_nothrow_move_assignable_v<E>)
+    {
+        if (this != &rhs)
+        {
+            m_error = std::move(rhs.m_error);
+            release();
+            m_head = std::exchange(rhs.m_head, nullptr);
+        }
+        return *this;
+    }
+
+    ~context_error() { release(); }
+
+    /// Adds `message`, which is copied, as the outermost context.
+    context_error &with_context(std::string_view message) &
+    {
+        m_head = expected_detail::context_arena::local().push(m_head, message);
+        return *this;
+    }
+    context_error &&with_context(std::string_view message) && { return std::move(with_context(message)); }
+
+    constexpr E       &error() & noexcept { return m_error; }
+    constexpr const E &error() const & noexcept { return m_error; }
+    constexpr E      &&error() && noexcept { return std::move(m_error); }
+
+    [[nodiscard]] context_range context() const noexcept { return context_range(m_head); }
+
+    [[nodiscard]] std::size_t depth() const noexcept
+    {
+        std::size_t n = 0;
+        for (const expected_detail::context_frame *f = m_head; f; f = f->next)
+        {
+            ++n;
+        }
+        return n;
+    }
+
+private:
+    void release() noexcept { expected_detail::context_arena::release(m_head); }
+
+    E                                     m_error;
+    const expected_detail::context_frame *m_head = nullptr;
+};
+
+namespace expected_detail
+{
+
+template<class G>
+auto add_context(G &&e, std::string_view message)
+{
+    if constexpr (is_specialization_v<remove_cvref_t<G>, context_error>)
+    {
+        return remove_cvref_t<G>(std::forward<G>(e)).with_context(message);
+    }
+    else
+    {
+        return context_error<remove_cvref_t<G>>(std::forward<G>(e)).with_context(message);
+    }
+}
+
+struct context_adder
+{
+    std::string_view m_message;
+
+    template<class G>
+    auto operator()(G &&e) const
+    {
+        return add_context(std::forward<G>(e), m_message);
+    }
+};
+
+} // namespace expected_detail
+
+/// A `transform_error` stage adding `message` to the error, which is
+/// wrapped into a `context_error` first if it is not one already. The
+/// message is only copied when there is an error.
+[[nodiscard]] inline auto with_context(std::string_view message)
+{
+    return transform_error(expected_detail::context_adder {message});
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
@@ -0,0 +1,279 @@
+#ifndef ZEUS_EXPECTED_COROUTINE_HPP
+#define ZEUS_EXPECTED_COROUTINE_HPP
+
+#include <zeus/expected.hpp>
+
+// The result of get_return_object() must be converted to the declared
+// `expected` once the coroutine has finished (see coroutine_result). Clang
+// converts it right away before Clang 17 (Apple Clang 16), so coroutine
+// support is left out there.
+#if defined(__clang__) && defined(__apple_build_version__)
+    #define ZEUS_EXPECTED_EAGER_RETURN_OBJECT (__clang_major__ < 16)
+#elif defined(__clang__)
+    #define ZEUS_EXPECTED_EAGER_RETURN_OBJECT (__clang_major__ < 17)
+#else
+    #define ZEUS_EXPECTED_EAGER_RETURN_OBJECT 0
+#endif
+
+#if ZEUS_EXPECTED_CPLUSPLUS >= 202'002L && defined(__cpp_impl_coroutine) && __has_include(<coroutine>) && !ZEUS_EXPECTED_EAGER_RETURN_OBJECT
+    #define ZEUS_EXPECTED_HAS_COROUTINES 1
+#else
+    #define ZEUS_EXPECTED_HAS_COROUTINES 0
+#endif
+
+// Set to 0 to allocate coroutine frames that cannot be elided with the
+// global operator new instead of the per-thread frame pool.
+#ifndef ZEUS_EXPECTED_COROUTINE_FRAME_POOL
+    #define ZEUS_EXPECTED_COROUTINE_FRAME_POOL 1
+#endif
+
+#if ZEUS_EXPECTED_HAS_COROUTINES
+
+    #include <coroutine>
+    #include <cstddef>
+    #include <new>
+    #include <optional>
+    #include <utility>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+// Per-thread cache of coroutine frames, bucketed by size. A coroutine
+// returning `expected` never suspends across threads, so its frame is
+// always released on the thread that allocated it, and consecutive calls
+// of the same coroutine keep reusing the same block. Frames that outlive
+// the call (generators) may be released elsewhere and then simply join
+// the cache of the releasing thread.
+class coroutine_frame_pool
+{
+public:
+    static constexpr std::size_t granularity = 64;
+    static constexpr std::size_t class_count = 16;
+    static constexpr std::size_t max_cached  = 8;
+
+    coroutine_frame_pool() = default;
+
+    coroutine_frame_pool(const coroutine_frame_pool &)            = delete;
+    coroutine_frame_pool &operator=(const coroutine_frame_pool &) = delete;
+
+    ~coroutine_frame_pool()
+    {
+        for (block *&head : m_free)
+        {
+            while (head)
+            {
+                ::operator delete(std::exchange(head, head->next));
+            }
+        }
+    }
+
+    static coroutine_frame_pool &local() noexcept
+    {
+        thread_local coroutine_frame_pool pool;
+        return pool;
+    }
+
+    void *allocate(std::size_t size)
+    {
+        std::size_t const c = size_class(size);
+        if (c >= class_count)
+        {
+            return ::operator new(size);
+        }
+        if (block *b = m_free[c])
+        {
+            m_free[c] = b->next;
+            --m_cached[c];
+            return b;
+        }
+        return ::operator new((c + 1) * granularity);
+    }
+
+    void deallocate(void *p, std::size_t size) noexcept
+    {
+        std::size_t const c = size_class(size);
+        if (c >= class_count || m_cached[c] == max_cached)
+        {
+            ::operator delete(p);
+            return;
+        }
+        m_free[c] = ::new (p) block {m_free[c]};
+        ++m_cached[c];
+    }
+
+private:
+    struct block
+    {
+        block *next;
+    };
+
+    static constexpr std::size_t size_class(std::size_t size) noexcept { return (size + granularity - 1) / granularity - 1; }
+
+    block      *m_free[class_count] {};
+    std::size_t m_cached[class_count] {};
+};
+
+    #if ZEUS_EXPECTED_COROUTINE_FRAME_POOL
+struct coroutine_frame_allocator
+{
+    static void *operator new(std::size_t size) { return coroutine_frame_pool::local().allocate(size); }
+    static void  operator delete(void *p, std::size_t size) noexcept { coroutine_frame_pool::local().deallocate(p, size); }
+};
+    #else
+struct coroutine_frame_allocator
+{
+};
+    #endif
+
+// Where the coroutine body leaves its result. It lives in the caller as
+// the object returned by get_return_object() and is converted to the
+// declared `expected` once the coroutine has finished, which requires a
+// compiler that delays that conversion (GCC, MSVC, Clang 17 and later;
+// see ZEUS_EXPECTED_EAGER_RETURN_OBJECT).
+template<class T, class E>
+class coroutine_result
+{
+public:
+    template<class Promise>
+    explicit coroutine_result(Promise &promise) noexcept
+    {
+        promise.m_result = this;
+    }
+
+    coroutine_result(const coroutine_result &)            = delete;
+    coroutine_result &operator=(const coroutine_result &) = delete;
+
+    operator expected<T, E>() && { return std::move(*m_value); }
+
+    template<class... Args>
+    void emplace(Args &&...args)
+    {
+        m_value.emplace(std::forward<Args>(args)...);
+    }
+
+private:
+    std::optional<expected<T, E>> m_value;
+};
+
+// co_await on an `expected`: resumes with its value, or stores its error
+// as the result of the coroutine and destroys the frame.
+template<class Exp>
+struct expected_awaiter
+{
+    Exp &&m_exp;
+
+    bool await_ready() const noexcept { return m_exp.has_value(); }
+
+    template<class Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        handle.promise().m_result->emplace(unexpect, std::forward<Exp>(m_exp).error());
+        handle.destroy();
+    }
+
+    decltype(auto) await_resume() noexcept
+    {
+        if constexpr (!std::is_void_v<typename remove_cvref_t<Exp>::value_type>)
+        {
+            return *std::forward<Exp>(m_exp);
+        }
+    }
+};
+
+// co_await on an `unexpected`: always returns its error.
+template<class Unex>
+struct unexpected_awaiter
+{
+    Unex &&m_unex;
+
+    bool await_ready() const noexcept { return false; }
+
+    template<class Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        handle.promise().m_result->emplace(unexpect, std::forward<Unex>(m_unex).error());
+        handle.destroy();
+    }
+
+    void await_resume() noexcept {}
+};
+
+template<class T, class E>
+struct expected_promise_base : coroutine_frame_allocator
+{
+    coroutine_result<T, E> *m_result = nullptr;
+
+    coroutine_result<T, E> get_return_object() noexcept { return coroutine_result<T, E>(*this); }
+
+    // never suspends except to return an error, so the frame lifetime is
+    // bounded by the call and may be elided by the compiler
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    std::suspend_never final_suspend() const noexcept { return {}; }
+
+    // lets the exception propagate to the caller, which destroys the frame
+    void unhandled_exception()
+    {
+    #if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+        throw;
+    #else
+        std::terminate();
+    #endif
+    }
+
+    template<class Exp, std::enable_if_t<is_specialization_v<remove_cvref_t<Exp>, expected>> * = nullptr>
+    expected_awaiter<Exp> await_transform(Exp &&e) noexcept
+    {
+        return expected_awaiter<Exp> {std::forward<Exp>(e)};
+    }
+
+    template<class Unex, std::enable_if_t<is_specialization_v<remove_cvref_t<Unex>, unexpected>> * = nullptr>
+    unexpected_awaiter<Unex> await_transform(Unex &&u) noexcept
+    {
+        return unexpected_awaiter<Unex> {std::forward<Unex>(u)};
+    }
+};
+
+template<class T, class E>
+struct expected_promise : expected_promise_base<T, E>
+{
+    template<class U = T>
+    void return_value(U &&v)
+    {
+        this->m_result->emplace(std::forward<U>(v));
+    }
+};
+
+template<class E>
+struct expected_promise<void, E> : expected_promise_base<void, E>
+{
+    void return_void() { this->m_result->emplace(); }
+};
+
+} // namespace expected_detail
+
+ZEUS_EXPECTED_NS_END
+
+/// Makes every function returning `zeus::expected<T, E>` usable as a
+/// coroutine in which `co_await e` yields the value of the `expected` e or
+/// returns its error from the coroutine, and `co_await unexpected(...)`
+/// returns an error directly:
+///
+///     zeus::expected<int, std::string> sum(std::string_view a, std::string_view b)
+///     {
+///         int const x = co_await parse(a);
+///         int const y = co_await parse(b);
+///         co_return x + y;
+///     }
+///
+/// Frames that the compiler does not elide come from a per-thread pool.
+template<class T, class E, class... Args>
+struct std::coroutine_traits<ZEUS_EXPECTED_NAMESPACE::expected<T, E>, Args...>
+{
+    using promise_type = ZEUS_EXPECTED_NAMESPACE::expected_detail::expected_promise<T, E>;
+};
+
+#endif
+
+#endif
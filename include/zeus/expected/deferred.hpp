@@ -0,0 +1,244 @@
+#ifndef ZEUS_EXPECTED_DEFERRED_HPP
+#define ZEUS_EXPECTED_DEFERRED_HPP
+
+#include <atomic>
+#include <memory>
+#if __has_include(<version>)
+    #include <version>
+#endif
+
+#if defined(__cpp_lib_atomic_wait) && __cpp_lib_atomic_wait >= 201'907L
+    #define ZEUS_EXPECTED_HAS_ATOMIC_WAIT 1
+#else
+    #define ZEUS_EXPECTED_HAS_ATOMIC_WAIT 0
+    #include <condition_variable>
+    #include <mutex>
+#endif
+
+#include <zeus/expected.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+// Runs the initialization of a deferred_expected at most once.
+template<bool ThreadSafe>
+class deferred_once
+{
+public:
+    bool is_done() const noexcept { return m_done; }
+
+    template<class Init>
+    void call(Init &&init)
+    {
+        if (!m_done)
+        {
+            std::forward<Init>(init)();
+            m_done = true;
+        }
+    }
+
+private:
+    bool m_done = false;
+};
+
+// Thread-safe variant: one caller runs the initialization while the
+// others block until the state word changes, with C++20 atomic wait (a
+// futex on Linux) where available and on a condition variable otherwise.
+// If the initialization throws, the state goes back to `empty` and the
+// next caller retries.
+template<>
+class deferred_once<true>
+{
+public:
+    bool is_done() const noexcept { return m_state.load(std::memory_order_acquire) == done; }
+
+    template<class Init>
+    void call(Init &&init)
+    {
+        unsigned char state = m_state.load(std::memory_order_acquire);
+        while (state != done)
+        {
+            if (state == empty)
+            {
+                if (m_state.compare_exchange_strong(state, running, std::memory_order_acquire, std::memory_order_acquire))
+                {
+                    release_guard guard {this};
+                    std::forward<Init>(init)();
+                    guard.m_final = done;
+                    return;
+                }
+            }
+            else
+            {
+                wait(state);
+                state = m_state.load(std::memory_order_acquire);
+            }
+        }
+    }
+
+private:
+    enum : unsigned char
+    {
+        empty,
+        running,
+        done,
+    };
+
+    struct release_guard
+    {
+        deferred_once *m_once;
+        unsigned char  m_final = empty;
+
+        ~release_guard()
+        {
+            m_once->m_state.store(m_final, std::memory_order_release);
+            m_once->notify();
+        }
+    };
+
+#if ZEUS_EXPECTED_HAS_ATOMIC_WAIT
+    void wait(unsigned char old) const noexcept { m_state.wait(old, std::memory_order_acquire); }
+
+    void notify() noexcept { m_state.notify_all(); }
+#else
+    void wait(unsigned char old) const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_changed.wait(lock, [this, old] { return m_state.load(std::memory_order_acquire) != old; });
+    }
+
+    // Taking the mutex after the state has been stored ensures that a
+    // waiter has either seen the new state or is already waiting.
+    void notify() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+        }
+        m_changed.notify_all();
+    }
+#endif
+
+    std::atomic<unsigned char> m_state {empty};
+#if !ZEUS_EXPECTED_HAS_ATOMIC_WAIT
+    mutable std::mutex              m_mutex;
+    mutable std::condition_variable m_changed;
+#endif
+};
+
+} // namespace expected_detail
+
+/// An `expected<T, E>` that is computed by invoking `F` on first access and
+/// cached afterwards, whether it holds a value or an error. The accessors
+/// mirror those of `expected` and trigger the computation.
+///
+/// With `ThreadSafe` set, concurrent first accesses run `F` only once and
+/// the other callers wait for its result. Otherwise the object must not
+/// be accessed concurrently before it has been computed.
+template<class T, class E, class F, bool ThreadSafe = false>
+class deferred_expected
+{
+public:
+    using expected_type   = expected<T, E>;
+    using value_type      = T;
+    using error_type      = E;
+    using unexpected_type = unexpected<E>;
+
+    static_assert(
+        std::is_constructible_v<expected_type, std::invoke_result_t<F &>>, "the result of F must be convertible to expected<T, E>"
+    );
+
+    template<class G, std::enable_if_t<std::is_constructible_v<F, G>> * = nullptr>
+    constexpr explicit deferred_expected(G &&func) noexcept(std::is_nothrow_constructible_v<F, G>)
+        : m_func(std::forward<G>(func))
+    {
+    }
+
+    deferred_expected(const deferred_expected &)            = delete;
+    deferred_expected &operator=(const deferred_expected &) = delete;
+
+    ~deferred_expected()
+    {
+        if (m_once.is_done())
+        {
+            m_result.~expected_type();
+        }
+    }
+
+    // whether the result has already been computed
+    [[nodiscard]] bool is_ready() const noexcept { return m_once.is_done(); }
+
+    // the computed `expected`
+    [[nodiscard]] const expected_type &get() const
+    {
+        m_once.call([this] { ::new (static_cast<void *>(std::addressof(m_result))) expected_type(std::invoke(m_func)); });
+        return m_result;
+    }
+
+    [[nodiscard]] bool has_value() const { return get().has_value(); }
+    explicit operator bool() const { return has_value(); }
+
+    decltype(auto) operator->() const { return get().operator->(); }
+    decltype(auto) operator*() const { return *get(); }
+
+    decltype(auto) value() const { return get().value(); }
+    const E       &error() const { return get().error(); }
+
+    template<class U>
+    T value_or(U &&v) const
+    {
+        return get().value_or(std::forward<U>(v));
+    }
+    template<class G>
+    E error_or(G &&v) const
+    {
+        return get().error_or(std::forward<G>(v));
+    }
+
+    template<class G>
+    auto and_then(G &&f) const
+    {
+        return get().and_then(std::forward<G>(f));
+    }
+    template<class G>
+    auto or_else(G &&f) const
+    {
+        return get().or_else(std::forward<G>(f));
+    }
+    template<class G>
+    auto transform(G &&f) const
+    {
+        return get().transform(std::forward<G>(f));
+    }
+    template<class G>
+    auto transform_error(G &&f) const
+    {
+        return get().transform_error(std::forward<G>(f));
+    }
+
+private:
+    mutable F                                          m_func;
+    mutable expected_detail::deferred_once<ThreadSafe> m_once;
+    union
+    {
+        mutable expected_type m_result;
+    };
+};
+
+template<class F>
+deferred_expected(F) -> deferred_expected<
+    typename expected_detail::remove_cvref_t<std::invoke_result_t<F &>>::value_type,
+    typename expected_detail::remove_cvref_t<std::invoke_result_t<F &>>::error_type,
+    F>;
+
+/// Creates a thread-safe `deferred_expected` computing its result with `f`.
+template<class F, class R = expected_detail::remove_cvref_t<std::invoke_result_t<std::decay_t<F> &>>>
+[[nodiscard]] deferred_expected<typename R::value_type, typename R::error_type, std::decay_t<F>, true> make_concurrent_deferred(F &&f)
+{
+    return deferred_expected<typename R::value_type, typename R::error_type, std::decay_t<F>, true>(std::forward<F>(f));
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
@@ -0,0 +1,280 @@
+#ifndef ZEUS_EXPECTED_DETAIL_SIMD_KERNELS_HPP
+#define ZEUS_EXPECTED_DETAIL_SIMD_KERNELS_HPP
+
+// The scans of <zeus/expected/simd.hpp> over the has-value flags, with the
+// x86 intrinsics they use kept out of the public headers.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <zeus/expected.hpp>
+
+#ifndef ZEUS_EXPECTED_SIMD
+    #error "include <zeus/expected/simd.hpp> instead"
+#endif
+
+#if ZEUS_EXPECTED_SIMD
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define ZEUS_EXPECTED_TARGET_AVX2
+    #else
+        #define ZEUS_EXPECTED_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+namespace simd_kernels
+{
+
+// index of the lowest set bit of x != 0
+inline unsigned lowest_bit(std::uint32_t x) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return static_cast<unsigned>(i);
+#else
+    return static_cast<unsigned>(__builtin_ctz(x));
+#endif
+}
+
+// All kernels take the address of the first flag byte, the number of
+// elements and the distance between two flags (the element size).
+
+inline std::size_t count_scalar(const unsigned char *flags, std::size_t n, std::size_t stride) noexcept
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        count += flags[i * stride];
+    }
+    return count;
+}
+
+inline std::size_t find_error_scalar(const unsigned char *flags, std::size_t n, std::size_t stride) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (!flags[i * stride])
+        {
+            return i;
+        }
+    }
+    return n;
+}
+
+// Stores bit `i % 64` of `mask[i / 64]`, starting at bit `first`;
+// `mask` is assumed to be zeroed.
+inline void mask_scalar(const unsigned char *flags, std::size_t n, std::size_t stride, std::uint64_t *mask, std::size_t first) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::size_t const bit = first + i;
+        mask[bit / 64] |= std::uint64_t {flags[i * stride]} << (bit % 64);
+    }
+}
+
+#if ZEUS_EXPECTED_SIMD
+
+// SSE2, for strides dividing 16: each 16-byte load holds 16 / stride whole
+// flags, at the byte positions selected by `lanes`.
+inline std::uint32_t sse2_lanes(std::size_t stride) noexcept
+{
+    std::uint32_t lanes = 0;
+    for (std::size_t b = 0; b < 16; b += stride)
+    {
+        lanes |= 1u << b;
+    }
+    return lanes;
+}
+
+// 0xff at the flag positions, 0 elsewhere
+inline __m128i sse2_lane_bytes(std::size_t stride) noexcept
+{
+    alignas(16) unsigned char bytes[16] = {};
+    for (std::size_t b = 0; b < 16; b += stride)
+    {
+        bytes[b] = 0xff;
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(bytes));
+}
+
+// bits of the bytes of v that are zero
+inline std::uint32_t sse2_zero_bytes(const unsigned char *p) noexcept
+{
+    __m128i const v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())));
+}
+
+// Number of leading elements from whose flag a 16-byte load stays inside
+// the array; the loads only start there, the rest goes to the scalar loop.
+inline std::size_t sse2_safe_count(std::size_t n, std::size_t stride, std::size_t after_flag) noexcept
+{
+    std::size_t const flag_offset = stride - after_flag;
+    return n * stride >= flag_offset + 16 ? (n * stride - flag_offset - 16) / stride + 1 : 0;
+}
+
+// Adds up the flag bytes, which are 0 or 1, with SAD into two 64-bit
+// lanes instead of counting mask bits.
+inline std::size_t count_sse2(const unsigned char *flags, std::size_t n, std::size_t stride, std::size_t after_flag) noexcept
+{
+    __m128i const     lanes    = sse2_lane_bytes(stride);
+    std::size_t const per_load = 16 / stride;
+    std::size_t const safe     = sse2_safe_count(n, stride, after_flag);
+
+    __m128i     sums = _mm_setzero_si128();
+    std::size_t i    = 0;
+    for (; i < safe; i += per_load)
+    {
+        __m128i const v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(flags + i * stride));
+        sums            = _mm_add_epi64(sums, _mm_sad_epu8(_mm_and_si128(v, lanes), _mm_setzero_si128()));
+    }
+    alignas(16) std::uint64_t halves[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(halves), sums);
+    return static_cast<std::size_t>(halves[0] + halves[1]) + count_scalar(flags + i * stride, n - i, stride);
+}
+
+inline std::size_t find_error_sse2(const unsigned char *flags, std::size_t n, std::size_t stride, std::size_t after_flag) noexcept
+{
+    std::uint32_t const lanes    = sse2_lanes(stride);
+    std::size_t const   per_load = 16 / stride;
+    std::size_t const   safe     = sse2_safe_count(n, stride, after_flag);
+
+    std::size_t i = 0;
+    for (; i < safe; i += per_load)
+    {
+        if (std::uint32_t const zero = sse2_zero_bytes(flags + i * stride) & lanes)
+        {
+            return i + lowest_bit(zero) / stride;
+        }
+    }
+    return i + find_error_scalar(flags + i * stride, n - i, stride);
+}
+
+// AVX2, any stride: gathers the 32-bit words starting at 8 flags and
+// moves their lowest bits (the bools) into an 8-bit mask. A word may
+// extend past its element, so the elements too close to the end of the
+// array are left to the scalar loop.
+ZEUS_EXPECTED_TARGET_AVX2 inline std::uint32_t avx2_flags8(const unsigned char *p, __m256i offsets) noexcept
+{
+    __m256i const words = _mm256_i32gather_epi32(reinterpret_cast<const int *>(p), offsets, 1);
+    return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(words, 31))));
+}
+
+ZEUS_EXPECTED_TARGET_AVX2 inline __m256i avx2_offsets(std::size_t stride) noexcept
+{
+    int const s = static_cast<int>(stride);
+    return _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+}
+
+inline std::size_t avx2_safe_count(std::size_t n, std::size_t stride, std::size_t after_flag) noexcept
+{
+    std::size_t const overrun = after_flag >= 4 ? 0 : (4 - after_flag + stride - 1) / stride;
+    return n > overrun ? n - overrun : 0;
+}
+
+// adds up the bools of the gathered words in eight 32-bit lanes, flushed
+// before they can overflow
+ZEUS_EXPECTED_TARGET_AVX2 inline std::size_t
+count_avx2(const unsigned char *flags, std::size_t n, std::size_t stride, std::size_t after_flag) noexcept
+{
+    __m256i const     offsets = avx2_offsets(stride);
+    __m256i const     ones    = _mm256_set1_epi32(1);
+    std::size_t const safe    = avx2_safe_count(n, stride, after_flag);
+
+    std::size_t count = 0;
+    std::size_t i     = 0;
+    while (i + 8 <= safe)
+    {
+        __m256i           sums  = _mm256_setzero_si256();
+        std::size_t const limit = std::min(safe, i + (std::size_t {1} << 30));
+        for (; i + 8 <= limit; i += 8)
+        {
+            __m256i const words = _mm256_i32gather_epi32(reinterpret_cast<const int *>(flags + i * stride), offsets, 1);
+            sums                = _mm256_add_epi32(sums, _mm256_and_si256(words, ones));
+        }
+        alignas(32) std::uint32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), sums);
+        for (std::uint32_t lane : lanes)
+        {
+            count += lane;
+        }
+    }
+    return count + count_scalar(flags + i * stride, n - i, stride);
+}
+
+ZEUS_EXPECTED_TARGET_AVX2 inline std::size_t
+find_error_avx2(const unsigned char *flags, std::size_t n, std::size_t stride, std::size_t after_flag) noexcept
+{
+    __m256i const     offsets = avx2_offsets(stride);
+    std::size_t const safe    = avx2_safe_count(n, stride, after_flag);
+
+    std::size_t i = 0;
+    for (; i + 8 <= safe; i += 8)
+    {
+        if (std::uint32_t const errors = ~avx2_flags8(flags + i * stride, offsets) & 0xffu)
+        {
+            return i + lowest_bit(errors);
+        }
+    }
+    return i + find_error_scalar(flags + i * stride, n - i, stride);
+}
+
+ZEUS_EXPECTED_TARGET_AVX2 inline void
+mask_avx2(const unsigned char *flags, std::size_t n, std::size_t stride, std::size_t after_flag, std::uint64_t *mask) noexcept
+{
+    __m256i const     offsets = avx2_offsets(stride);
+    std::size_t const safe    = avx2_safe_count(n, stride, after_flag);
+
+    std::size_t i = 0;
+    for (; i + 8 <= safe; i += 8)
+    {
+        mask[i / 64] |= std::uint64_t {avx2_flags8(flags + i * stride, offsets)} << (i % 64);
+    }
+    mask_scalar(flags + i * stride, n - i, stride, mask, i);
+}
+
+inline bool cpu_has_avx2() noexcept
+{
+    #if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+    __cpuid(info, 1);
+    bool const osxsave = (info[2] & (1 << 27)) != 0;
+    bool const avx     = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+    #else
+    return __builtin_cpu_supports("avx2");
+    #endif
+}
+
+inline bool use_avx2() noexcept
+{
+    static bool const supported = cpu_has_avx2();
+    return supported;
+}
+
+#endif
+
+} // namespace simd_kernels
+
+} // namespace expected_detail
+
+ZEUS_EXPECTED_NS_END
+
+#endif
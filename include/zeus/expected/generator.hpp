@@ -0,0 +1,210 @@
+#ifndef ZEUS_EXPECTED_GENERATOR_HPP
+#define ZEUS_EXPECTED_GENERATOR_HPP
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/coroutine.hpp>
+
+#if ZEUS_EXPECTED_HAS_COROUTINES
+
+    #include <cstddef>
+    #include <exception>
+    #include <iterator>
+    #include <memory>
+    #include <optional>
+    #include <utility>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+/// A coroutine producing a lazy sequence of `expected<T, E>`:
+///
+///     zeus::expected_generator<Record, ParseError> records(std::istream &in)
+///     {
+///         for (std::string line; std::getline(in, line);)
+///         {
+///             if (line.empty())
+///                 co_yield zeus::unexpected(ParseError::empty_line);
+///             else
+///                 co_yield parse(line);
+///         }
+///     }
+///
+/// `co_yield` accepts anything `expected<T, E>` can be constructed from:
+/// an `expected`, a `T` or an `unexpected`. The generator is an input
+/// range whose elements are only valid until the iterator is incremented.
+/// After `stop_at_first_error()`, iteration ends after the first error has
+/// been produced.
+template<class T, class E>
+class expected_generator
+{
+public:
+    using value_type = expected<T, E>;
+
+    class promise_type : public expected_detail::coroutine_frame_allocator
+    {
+    public:
+        expected_generator get_return_object() noexcept
+        {
+            return expected_generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        // a yielded `expected` temporary lives in the coroutine frame until
+        // it is resumed, so only its address is kept
+        std::suspend_always yield_value(value_type &&v) noexcept
+        {
+            m_current = std::addressof(v);
+            return {};
+        }
+
+        // anything else, lvalue `expected`s included, is converted into a
+        // copy owned by the promise
+        template<class U, std::enable_if_t<!std::is_same_v<U, value_type> && std::is_constructible_v<value_type, U>> * = nullptr>
+        std::suspend_always yield_value(U &&v) noexcept(std::is_nothrow_constructible_v<value_type, U>)
+        {
+            m_converted.emplace(std::forward<U>(v));
+            m_current = std::addressof(*m_converted);
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept { m_exception = std::current_exception(); }
+
+        // disallow co_await inside generators
+        template<class U>
+        std::suspend_never await_transform(U &&) = delete;
+
+    private:
+        friend class expected_generator;
+
+        void rethrow_if_exception()
+        {
+            if (m_exception)
+            {
+    #if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+                std::rethrow_exception(std::exchange(m_exception, nullptr));
+    #else
+                std::terminate();
+    #endif
+            }
+        }
+
+        value_type               *m_current = nullptr;
+        std::optional<value_type> m_converted;
+        std::exception_ptr        m_exception;
+        bool                      m_stop_at_first_error = false;
+    };
+
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = expected<T, E>;
+        using reference         = value_type &;
+        using pointer           = value_type *;
+
+        iterator() noexcept = default;
+
+        reference operator*() const noexcept { return *m_handle.promise().m_current; }
+        pointer operator->() const noexcept { return std::addressof(**this); }
+
+        iterator &operator++()
+        {
+            promise_type &promise = m_handle.promise();
+            if (promise.m_stop_at_first_error && !promise.m_current->has_value())
+            {
+                m_handle = nullptr;
+                return *this;
+            }
+            advance(m_handle);
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator &it, std::default_sentinel_t) noexcept { return !it.m_handle; }
+        friend bool operator!=(const iterator &it, std::default_sentinel_t s) noexcept { return !(it == s); }
+        friend bool operator==(std::default_sentinel_t s, const iterator &it) noexcept { return it == s; }
+        friend bool operator!=(std::default_sentinel_t s, const iterator &it) noexcept { return !(it == s); }
+
+    private:
+        friend class expected_generator;
+
+        explicit iterator(std::coroutine_handle<promise_type> handle) noexcept
+            : m_handle(handle)
+        {
+        }
+
+        // resumes the coroutine; clears `handle` once it has finished
+        static void advance(std::coroutine_handle<promise_type> &handle)
+        {
+            handle.resume();
+            if (handle.done())
+            {
+                handle.promise().rethrow_if_exception();
+                handle = nullptr;
+            }
+        }
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    expected_generator(expected_generator &&rhs) noexcept
+        : m_handle(std::exchange(rhs.m_handle, nullptr))
+    {
+    }
+
+    expected_generator &operator=(expected_generator &&rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            destroy();
+            m_handle = std::exchange(rhs.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    ~expected_generator() { destroy(); }
+
+    expected_generator &stop_at_first_error() & noexcept
+    {
+        m_handle.promise().m_stop_at_first_error = true;
+        return *this;
+    }
+    // returns by value so that `for (auto &e : gen().stop_at_first_error())`
+    // does not bind to a destroyed temporary
+    expected_generator stop_at_first_error() && noexcept { return std::move(stop_at_first_error()); }
+
+    // Starts the coroutine; may only be called once.
+    iterator begin()
+    {
+        std::coroutine_handle<promise_type> handle = m_handle;
+        iterator::advance(handle);
+        return iterator(handle);
+    }
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+    explicit expected_generator(std::coroutine_handle<promise_type> handle) noexcept
+        : m_handle(handle)
+    {
+    }
+
+    void destroy() noexcept
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+ZEUS_EXPECTED_NS_END
+
+#endif
+
+#endif
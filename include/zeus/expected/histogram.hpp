@@ -0,0 +1,274 @@
+#ifndef ZEUS_EXPECTED_HISTOGRAM_HPP
+#define ZEUS_EXPECTED_HISTOGRAM_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/collect.hpp>
+#include <zeus/expected/parallel.hpp>
+#include <zeus/expected/partition.hpp>
+#include <zeus/expected/simd_expected.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+template<class E>
+inline constexpr bool is_error_code_v = std::is_enum_v<E> || (std::is_integral_v<E> && !std::is_same_v<E, bool>);
+
+// The index of `e` in a dense array of `limit` counts, or `limit` if the
+// code is negative or does not fit.
+template<class E>
+constexpr std::size_t dense_code_index(const E &e, std::size_t limit) noexcept
+{
+    using code_type = std::conditional_t<std::is_enum_v<E>, std::underlying_type<E>, std::common_type<E>>;
+    auto const code = static_cast<typename code_type::type>(e);
+    if constexpr (std::is_signed_v<typename code_type::type>)
+    {
+        if (code < 0)
+        {
+            return limit;
+        }
+    }
+    auto const index = static_cast<std::make_unsigned_t<typename code_type::type>>(code);
+    return index < limit ? static_cast<std::size_t>(index) : limit;
+}
+
+} // namespace expected_detail
+
+/// How many times each error code occurred. `E` is an enumeration or an
+/// integer type. Codes from 0 to `dense_limit - 1` are counted in a flat
+/// array indexed by the value of the code, which grows to the largest of
+/// them counted; negative and larger codes are counted in a sorted map.
+template<class E>
+class error_counts
+{
+    static_assert(expected_detail::is_error_code_v<E>, "error_counts requires an enumeration or an integer error type");
+
+public:
+    using error_type = E;
+
+    static constexpr std::size_t dense_limit = 4096;
+
+    /// Number of times `e` was counted.
+    std::size_t operator[](const E &e) const
+    {
+        std::size_t const code = expected_detail::dense_code_index(e, dense_limit);
+        if (code == dense_limit)
+        {
+            auto const it = m_sparse.find(e);
+            return it != m_sparse.end() ? it->second : 0;
+        }
+        return code < m_counts.size() ? m_counts[code] : 0;
+    }
+
+    /// Number of errors counted, whatever their code.
+    std::size_t total() const noexcept
+    {
+        std::size_t sum = 0;
+        for (std::size_t n : m_counts)
+        {
+            sum += n;
+        }
+        for (const auto &entry : m_sparse)
+        {
+            sum += entry.second;
+        }
+        return sum;
+    }
+
+    /// The count of every code below `dense_limit`, at the index of its
+    /// value, up to the largest such code counted.
+    const std::vector<std::size_t> &counts() const noexcept { return m_counts; }
+
+    /// The count of every negative code or code from `dense_limit` on.
+    const std::map<E, std::size_t> &sparse_counts() const noexcept { return m_sparse; }
+
+    void add(const E &e, std::size_t n = 1)
+    {
+        std::size_t const code = expected_detail::dense_code_index(e, dense_limit);
+        if (code == dense_limit)
+        {
+            m_sparse[e] += n;
+            return;
+        }
+        if (code >= m_counts.size())
+        {
+            m_counts.resize(code + 1);
+        }
+        m_counts[code] += n;
+    }
+
+    error_counts &operator+=(const error_counts &other)
+    {
+        if (other.m_counts.size() > m_counts.size())
+        {
+            m_counts.resize(other.m_counts.size());
+        }
+        for (std::size_t code = 0; code < other.m_counts.size(); ++code)
+        {
+            m_counts[code] += other.m_counts[code];
+        }
+        for (const auto &entry : other.m_sparse)
+        {
+            m_sparse[entry.first] += entry.second;
+        }
+        return *this;
+    }
+
+private:
+    std::vector<std::size_t> m_counts;
+    std::map<E, std::size_t> m_sparse;
+};
+
+namespace expected_detail
+{
+
+template<class T>
+inline constexpr bool is_simd_expected_v = false;
+template<class T, std::size_t N, class E>
+inline constexpr bool is_simd_expected_v<simd_expected<T, N, E>> = true;
+
+// The error type counted in an element: that of an expected or a
+// simd_expected, or the element itself.
+template<class X, bool = is_specialization_v<X, expected> || is_simd_expected_v<X>>
+struct histogram_error
+{
+    using type = X;
+};
+
+template<class X>
+struct histogram_error<X, true>
+{
+    using type = typename X::error_type;
+};
+
+template<class Range>
+using histogram_error_t = typename histogram_error<range_expected_t<Range>>::type;
+
+template<class Range, class = void>
+inline constexpr bool is_histogram_range_v = false;
+template<class Range>
+inline constexpr bool is_histogram_range_v<Range, std::void_t<histogram_error_t<Range>>> = is_error_code_v<histogram_error_t<Range>>;
+
+// Counts the error of `e`, if it holds one; the errors of the lanes of a
+// simd_expected that failed; or `e` itself.
+template<class E, class Element>
+void count_errors(error_counts<E> &counts, const Element &e)
+{
+    if constexpr (is_specialization_v<Element, expected>)
+    {
+        if (!e.has_value())
+        {
+            counts.add(e.error());
+        }
+    }
+    else if constexpr (is_simd_expected_v<Element>)
+    {
+        for (std::size_t lane = 0; lane < Element::size(); ++lane)
+        {
+            if (!e.has_value(lane))
+            {
+                counts.add(e.errors()[lane]);
+            }
+        }
+    }
+    else
+    {
+        counts.add(e);
+    }
+}
+
+} // namespace expected_detail
+
+/// Counts the errors of a range by error code, see `error_counts`. The
+/// range may hold `expected<T, E>`, whose values are skipped, the lanes of
+/// `simd_expected<T, N, E>`, or the error codes themselves, such as
+/// `partitioned_results::errors`.
+///
+///     std::vector<zeus::expected<record, parse_error>> results = parse_all(lines);
+///     zeus::error_counts<parse_error> counts = zeus::error_histogram(results);
+///     report(counts[parse_error::bad_date], counts.total());
+template<class Range, std::enable_if_t<expected_detail::is_histogram_range_v<Range>> * = nullptr>
+auto error_histogram(const Range &r)
+{
+    error_counts<expected_detail::histogram_error_t<Range>> counts;
+    for (const auto &e : r)
+    {
+        expected_detail::count_errors(counts, e);
+    }
+    return counts;
+}
+
+/// The errors of a `partitioned_results`, which are already contiguous.
+template<class T, class E>
+error_counts<E> error_histogram(const partitioned_results<T, E> &results)
+{
+    return error_histogram(results.errors);
+}
+
+/// The errors of the lanes of a `simd_expected` that failed.
+template<class T, std::size_t N, class E>
+error_counts<E> error_histogram(const simd_expected<T, N, E> &lanes)
+{
+    error_counts<E> counts;
+    expected_detail::count_errors(counts, lanes);
+    return counts;
+}
+
+/// Parallel `error_histogram()` of a random access range. Every worker
+/// counts the chunks it takes into its own histogram, in a local array
+/// that no other thread writes to, and the histograms are added up once
+/// all of them are done.
+template<class Range, std::enable_if_t<expected_detail::is_histogram_range_v<Range>> * = nullptr>
+auto error_histogram(const parallel_policy &policy, const Range &r)
+{
+    static_assert(expected_detail::is_random_access_range_v<Range>, "the parallel error_histogram() requires a random access range");
+
+    using Counts = error_counts<expected_detail::histogram_error_t<Range>>;
+
+    auto const                           first = std::begin(r);
+    std::size_t const                    size  = static_cast<std::size_t>(std::size(r));
+    expected_detail::parallel_plan const plan(policy, size);
+    expected_detail::chunk_dispenser     chunks(size, plan.chunk_size);
+
+    std::vector<Counts> partials(plan.threads);
+
+    auto body = [&](std::size_t worker) {
+        Counts      local;
+        std::size_t begin = 0;
+        std::size_t end   = 0;
+        while (chunks.next(begin, end))
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                expected_detail::count_errors(local, first[static_cast<std::ptrdiff_t>(i)]);
+            }
+        }
+        partials[worker] = std::move(local);
+    };
+    expected_detail::run_workers(plan.threads, body, []() noexcept {});
+
+    Counts counts;
+    for (const Counts &partial : partials)
+    {
+        counts += partial;
+    }
+    return counts;
+}
+
+template<class T, class E>
+error_counts<E> error_histogram(const parallel_policy &policy, const partitioned_results<T, E> &results)
+{
+    return error_histogram(policy, results.errors);
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
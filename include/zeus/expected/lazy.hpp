@@ -0,0 +1,288 @@
+#ifndef ZEUS_EXPECTED_LAZY_HPP
+#define ZEUS_EXPECTED_LAZY_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <zeus/expected.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+template<class Exp, class... Stages>
+class lazy_expected;
+
+template<class... Stages>
+class pipe_adaptor;
+
+namespace expected_detail
+{
+
+struct and_then_stage_t
+{
+};
+struct transform_stage_t
+{
+};
+struct transform_error_stage_t
+{
+};
+struct or_else_stage_t
+{
+};
+
+template<class Kind, class F>
+struct lazy_stage
+{
+    using kind = Kind;
+
+    F func;
+};
+
+// The type produced by the equivalent chain of member calls.
+template<class Exp, class... Stages>
+struct lazy_result
+{
+    using type = remove_cvref_t<Exp>;
+};
+template<class Exp, class F, class... Rest>
+struct lazy_result<Exp, lazy_stage<and_then_stage_t, F>, Rest...>
+    : lazy_result<decltype(std::declval<Exp>().and_then(std::declval<F &>())), Rest...>
+{
+};
+template<class Exp, class F, class... Rest>
+struct lazy_result<Exp, lazy_stage<transform_stage_t, F>, Rest...>
+    : lazy_result<decltype(std::declval<Exp>().transform(std::declval<F &>())), Rest...>
+{
+};
+template<class Exp, class F, class... Rest>
+struct lazy_result<Exp, lazy_stage<transform_error_stage_t, F>, Rest...>
+    : lazy_result<decltype(std::declval<Exp>().transform_error(std::declval<F &>())), Rest...>
+{
+};
+template<class Exp, class F, class... Rest>
+struct lazy_result<Exp, lazy_stage<or_else_stage_t, F>, Rest...>
+    : lazy_result<decltype(std::declval<Exp>().or_else(std::declval<F &>())), Rest...>
+{
+};
+
+// Walks the stages in continuation-passing style: the current value or
+// error is forwarded by reference from one stage to the next and only the
+// final `Result` is materialized. Stages that do not apply to the current
+// alternative are skipped at compile time.
+template<class Result, class StageTuple>
+struct lazy_runner
+{
+    static constexpr std::size_t stage_count = std::tuple_size_v<StageTuple>;
+
+    template<std::size_t I, class... V>
+    static constexpr Result on_value(StageTuple &stages, V &&...v)
+    {
+        if constexpr (I == stage_count)
+        {
+            return Result(std::in_place, std::forward<V>(v)...);
+        }
+        else
+        {
+            auto &stage = std::get<I>(stages);
+            using Kind  = typename remove_cvref_t<decltype(stage)>::kind;
+
+            if constexpr (std::is_same_v<Kind, and_then_stage_t>)
+            {
+                remove_cvref_t<std::invoke_result_t<decltype((stage.func)), V...>> r = std::invoke(stage.func, std::forward<V>(v)...);
+                return resume<I + 1>(stages, std::move(r));
+            }
+            else if constexpr (std::is_same_v<Kind, transform_stage_t>)
+            {
+                using U = remove_cvref_t<std::invoke_result_t<decltype((stage.func)), V...>>;
+                if constexpr (std::is_void_v<U>)
+                {
+                    std::invoke(stage.func, std::forward<V>(v)...);
+                    return on_value<I + 1>(stages);
+                }
+                else if constexpr (I + 1 == stage_count)
+                {
+                    return Result(construct_with_invoke_result_t {}, stage.func, std::forward<V>(v)...);
+                }
+                else
+                {
+                    return on_value<I + 1>(stages, static_cast<U>(std::invoke(stage.func, std::forward<V>(v)...)));
+                }
+            }
+            else
+            {
+                return on_value<I + 1>(stages, std::forward<V>(v)...);
+            }
+        }
+    }
+
+    template<std::size_t I, class G>
+    static constexpr Result on_error(StageTuple &stages, G &&g)
+    {
+        if constexpr (I == stage_count)
+        {
+            return Result(unexpect, std::forward<G>(g));
+        }
+        else
+        {
+            auto &stage = std::get<I>(stages);
+            using Kind  = typename remove_cvref_t<decltype(stage)>::kind;
+
+            if constexpr (std::is_same_v<Kind, or_else_stage_t>)
+            {
+                remove_cvref_t<std::invoke_result_t<decltype((stage.func)), G>> r = std::invoke(stage.func, std::forward<G>(g));
+                return resume<I + 1>(stages, std::move(r));
+            }
+            else if constexpr (std::is_same_v<Kind, transform_error_stage_t>)
+            {
+                using E2 = remove_cvref_t<std::invoke_result_t<decltype((stage.func)), G>>;
+                if constexpr (I + 1 == stage_count)
+                {
+                    return Result(construct_with_invoke_result_t {}, unexpect, stage.func, std::forward<G>(g));
+                }
+                else
+                {
+                    return on_error<I + 1>(stages, static_cast<E2>(std::invoke(stage.func, std::forward<G>(g))));
+                }
+            }
+            else
+            {
+                return on_error<I + 1>(stages, std::forward<G>(g));
+            }
+        }
+    }
+
+    // Continues with the alternative held by an intermediate `expected`
+    // returned from an and_then() or or_else() callable.
+    template<std::size_t I, class Exp>
+    static constexpr Result resume(StageTuple &stages, Exp &&e)
+    {
+        if (e.has_value())
+        {
+            if constexpr (std::is_void_v<typename remove_cvref_t<Exp>::value_type>)
+            {
+                return on_value<I>(stages);
+            }
+            else
+            {
+                return on_value<I>(stages, *std::forward<Exp>(e));
+            }
+        }
+        else
+        {
+            return on_error<I>(stages, std::forward<Exp>(e).error());
+        }
+    }
+};
+
+} // namespace expected_detail
+
+/// A chain of monadic operations on an `expected` that is only evaluated
+/// by `eval()`. Unlike the equivalent chain of member calls, no
+/// intermediate `expected` is created for stages that merely pass the
+/// current value or error through, values produced by `transform()` are
+/// handed to the next stage by reference, and stages that do not apply to
+/// the current alternative are skipped without testing `has_value()`.
+///
+/// The result type is the type of the equivalent member chain. An lvalue
+/// source is referred to, so it must outlive the chain; an rvalue source is
+/// moved into the chain, and along with it at every stage added, so that
+/// a chain stored with `auto` never refers to a destroyed temporary.
+template<class Exp, class... Stages>
+class lazy_expected
+{
+    template<class, class...>
+    friend class lazy_expected;
+    template<class...>
+    friend class pipe_adaptor;
+
+    using stage_tuple = std::tuple<Stages...>;
+
+    // `Exp` is a reference for lvalue sources, and for rvalue ones that
+    // are evaluated within the same expression (see `pipe_adaptor`)
+    using source_storage = std::conditional_t<std::is_reference_v<Exp>, Exp &&, Exp>;
+
+public:
+    using source_type = expected_detail::remove_cvref_t<Exp>;
+    using result_type = typename expected_detail::lazy_result<Exp, Stages...>::type;
+
+    constexpr explicit lazy_expected(Exp &&source, stage_tuple stages)
+        : m_source(std::forward<Exp>(source))
+        , m_stages(std::move(stages))
+    {
+    }
+
+    template<class F>
+    constexpr auto and_then(F &&f) &&
+    {
+        return append<expected_detail::and_then_stage_t>(std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto transform(F &&f) &&
+    {
+        return append<expected_detail::transform_stage_t>(std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto transform_error(F &&f) &&
+    {
+        return append<expected_detail::transform_error_stage_t>(std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto or_else(F &&f) &&
+    {
+        return append<expected_detail::or_else_stage_t>(std::forward<F>(f));
+    }
+
+    [[nodiscard]] constexpr result_type eval() &&
+    {
+        using runner = expected_detail::lazy_runner<result_type, stage_tuple>;
+
+        if (m_source.has_value())
+        {
+            if constexpr (std::is_void_v<typename source_type::value_type>)
+            {
+                return runner::template on_value<0>(m_stages);
+            }
+            else
+            {
+                return runner::template on_value<0>(m_stages, *std::forward<Exp>(m_source));
+            }
+        }
+        else
+        {
+            return runner::template on_error<0>(m_stages, std::forward<Exp>(m_source).error());
+        }
+    }
+
+    // allows `expected<U, G> r = e | zeus::transform(f);`
+    constexpr operator result_type() && { return std::move(*this).eval(); }
+
+private:
+    template<class Kind, class F>
+    constexpr auto append(F &&f)
+    {
+        using stage = expected_detail::lazy_stage<Kind, std::decay_t<F>>;
+        return append_all(std::tuple<stage> {stage {std::forward<F>(f)}});
+    }
+
+    template<class... More>
+    constexpr lazy_expected<Exp, Stages..., More...> append_all(std::tuple<More...> more)
+    {
+        return lazy_expected<Exp, Stages..., More...>(std::forward<Exp>(m_source), std::tuple_cat(std::move(m_stages), std::move(more)));
+    }
+
+    source_storage m_source;
+    stage_tuple    m_stages;
+};
+
+/// Starts a lazily evaluated chain of monadic operations on `e`.
+template<class Exp, std::enable_if_t<expected_detail::is_specialization_v<expected_detail::remove_cvref_t<Exp>, expected>> * = nullptr>
+[[nodiscard]] constexpr lazy_expected<Exp> lazy(Exp &&e)
+{
+    return lazy_expected<Exp>(std::forward<Exp>(e), std::tuple<> {});
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
@@ -0,0 +1,301 @@
+#ifndef ZEUS_EXPECTED_PARALLEL_HPP
+#define ZEUS_EXPECTED_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/collect.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+/// How the parallel algorithms split their work. Each call runs on
+/// `threads` threads, the calling one included, which take chunks of
+/// `chunk_size` consecutive elements in increasing order. There is no
+/// thread pool: every call starts its threads and joins them before it
+/// returns, which costs tens of microseconds, so the parallel algorithms
+/// only pay off when a call has at least that much work to share.
+struct parallel_policy
+{
+    // 0 for std::thread::hardware_concurrency()
+    std::size_t threads = 0;
+    // 0 to derive it from the input size and the number of threads
+    std::size_t chunk_size = 0;
+};
+
+namespace expected_detail
+{
+
+// Hands out the chunks [begin, end) of [0, size) in increasing order.
+class chunk_dispenser
+{
+public:
+    chunk_dispenser(std::size_t size, std::size_t chunk_size) noexcept
+        : m_size(size)
+        , m_chunk_size(chunk_size)
+    {
+    }
+
+    bool next(std::size_t &begin, std::size_t &end) noexcept
+    {
+        begin = m_next.fetch_add(m_chunk_size, std::memory_order_relaxed);
+        if (begin >= m_size)
+        {
+            return false;
+        }
+        end = std::min(begin + m_chunk_size, m_size);
+        return true;
+    }
+
+private:
+    std::atomic<std::size_t> m_next {0};
+    std::size_t              m_size;
+    std::size_t              m_chunk_size;
+};
+
+// Thread count and chunk size for `size` elements under `policy`.
+struct parallel_plan
+{
+    std::size_t threads;
+    std::size_t chunk_size;
+
+    parallel_plan(const parallel_policy &policy, std::size_t size) noexcept
+    {
+        std::size_t const hardware = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        std::size_t const wanted   = policy.threads != 0 ? policy.threads : hardware;
+
+        chunk_size               = policy.chunk_size != 0 ? policy.chunk_size : std::max<std::size_t>(size / (wanted * 8), 1);
+        std::size_t const chunks = (size + chunk_size - 1) / chunk_size;
+        threads                  = std::max<std::size_t>(std::min(wanted, chunks), 1);
+    }
+};
+
+// Runs `body(worker)` for worker = 0 .. threads - 1, the last one on the
+// calling thread, and joins. If a worker throws, or a thread cannot be
+// started, `on_exception()` is called so that the others can stop early,
+// and the exception is rethrown once all of them are done.
+template<class Body, class OnException>
+void run_workers(std::size_t threads, Body &body, OnException &&on_exception)
+{
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    std::exception_ptr exception;
+    std::mutex         exception_mutex;
+
+    auto guarded = [&](std::size_t worker) {
+        try
+        {
+            body(worker);
+        }
+        catch (...)
+        {
+            on_exception();
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+    };
+#else
+    (void) on_exception;
+    auto &guarded = body;
+#endif
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    auto const join = [&workers]() {
+        for (std::thread &t : workers)
+        {
+            t.join();
+        }
+    };
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    // a thread that cannot be started throws std::system_error; the ones
+    // already running must be joined first, as destroying them would
+    // terminate
+    try
+    {
+        for (std::size_t w = 0; w + 1 < threads; ++w)
+        {
+            workers.emplace_back(guarded, w);
+        }
+    }
+    catch (...)
+    {
+        on_exception();
+        join();
+        throw;
+    }
+#else
+    for (std::size_t w = 0; w + 1 < threads; ++w)
+    {
+        workers.emplace_back(guarded, w);
+    }
+#endif
+    guarded(threads - 1);
+    join();
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+#endif
+}
+
+// The error with the smallest index reported by any worker. `limit()`
+// only decreases, so workers may skip every index at or past it while
+// the indices below it are still processed by whoever claimed them: the
+// result does not depend on scheduling.
+template<class E>
+class earliest_error
+{
+public:
+    std::size_t limit() const noexcept { return m_limit.load(std::memory_order_relaxed); }
+
+    // stops all workers without recording an error
+    void cancel() noexcept { m_limit.store(0, std::memory_order_relaxed); }
+
+    template<class G>
+    void record(std::size_t index, G &&e)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_error || index < m_index)
+        {
+            m_error.emplace(std::forward<G>(e));
+            m_index = index;
+            m_limit.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    bool has_error() const noexcept { return m_error.has_value(); }
+    std::size_t index() const noexcept { return m_index; }
+    E &&error() && noexcept { return std::move(*m_error); }
+
+private:
+    std::atomic<std::size_t> m_limit {std::numeric_limits<std::size_t>::max()};
+    std::mutex               m_mutex;
+    std::optional<E>         m_error;
+    std::size_t              m_index = 0;
+};
+
+template<class Range>
+inline constexpr bool is_random_access_range_v = std::is_base_of_v<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<decltype(std::begin(std::declval<Range &>()))>::iterator_category>;
+
+} // namespace expected_detail
+
+/// Applies `f`, which returns `expected<U, E>`, to every element of the
+/// random access range `r` on several threads and returns the results in
+/// order as `expected<std::vector<U>, E>` (`expected<void, E>` if `U` is
+/// void).
+///
+/// As soon as `f` fails, the workers abandon the elements past the failed
+/// one. Those before it are still processed, so the error returned is
+/// always the one of the smallest index, whatever the scheduling.
+template<class Range, class F>
+auto parallel_transform(const parallel_policy &policy, Range &&r, F &&f)
+{
+    static_assert(expected_detail::is_random_access_range_v<Range>, "parallel_transform() requires a random access range");
+
+    using Arg = decltype(expected_detail::forward_element<Range>(std::declval<expected_detail::range_reference_t<Range>>()));
+    using R   = expected_detail::remove_cvref_t<std::invoke_result_t<F &, Arg>>;
+    static_assert(expected_detail::is_specialization_v<R, expected>, "f must return a specialization of expected");
+
+    using U = typename R::value_type;
+    using E = typename R::error_type;
+
+    auto const                           first = std::begin(r);
+    std::size_t const                    size  = static_cast<std::size_t>(std::size(r));
+    expected_detail::parallel_plan const plan(policy, size);
+    expected_detail::chunk_dispenser     chunks(size, plan.chunk_size);
+    expected_detail::earliest_error<E>   error;
+
+    // default constructible values are assigned in place, others go
+    // through an optional; so does bool, as vector<bool> packs its bits
+    using slot = std::conditional_t<
+        std::is_void_v<U> || (std::is_default_constructible_v<U> && !std::is_same_v<U, bool>),
+        U,
+        std::optional<U>>;
+    std::conditional_t<std::is_void_v<U>, char, std::vector<slot>> values {};
+    if constexpr (!std::is_void_v<U>)
+    {
+        values.resize(size);
+    }
+
+    auto body = [&](std::size_t) {
+        std::size_t begin = 0;
+        std::size_t end   = 0;
+        while (chunks.next(begin, end) && begin < error.limit())
+        {
+            for (std::size_t i = begin; i < end && i < error.limit(); ++i)
+            {
+                R result = std::invoke(f, expected_detail::forward_element<Range>(first[static_cast<std::ptrdiff_t>(i)]));
+                if (!result.has_value())
+                {
+                    error.record(i, std::move(result).error());
+                }
+                else if constexpr (!std::is_void_v<U>)
+                {
+                    values[i] = *std::move(result);
+                }
+            }
+        }
+    };
+    expected_detail::run_workers(plan.threads, body, [&]() noexcept { error.cancel(); });
+
+    if constexpr (std::is_void_v<U>)
+    {
+        if (error.has_error())
+        {
+            return expected<void, E>(unexpect, std::move(error).error());
+        }
+        return expected<void, E>();
+    }
+    else
+    {
+        using Result = expected<std::vector<U>, E>;
+        if (error.has_error())
+        {
+            return Result(unexpect, std::move(error).error());
+        }
+        if constexpr (std::is_same_v<slot, U>)
+        {
+            return Result(std::in_place, std::move(values));
+        }
+        else
+        {
+            std::vector<U> out;
+            out.reserve(size);
+            for (slot &v : values)
+            {
+                out.push_back(*std::move(v));
+            }
+            return Result(std::in_place, std::move(out));
+        }
+    }
+}
+
+/// `parallel_transform()` with the default `parallel_policy`.
+template<class Range, class F>
+auto parallel_transform(Range &&r, F &&f)
+{
+    return parallel_transform(parallel_policy {}, std::forward<Range>(r), std::forward<F>(f));
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef ZEUS_EXPECTED_PARTITION_HPP
+#define ZEUS_EXPECTED_PARTITION_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/collect.hpp>
+#include <zeus/expected/parallel.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+/// The values and the errors of a range of `expected<T, E>`, each kept
+/// contiguous and in input order. `errors[i]` came from the element at
+/// `error_indices[i]` in the input.
+template<class T, class E>
+struct partitioned_results
+{
+    std::vector<T>           values;
+    std::vector<std::size_t> error_indices;
+    std::vector<E>           errors;
+};
+
+/// For ranges of `expected<void, E>`, only the successes are counted.
+template<class E>
+struct partitioned_results<void, E>
+{
+    std::size_t              value_count = 0;
+    std::vector<std::size_t> error_indices;
+    std::vector<E>           errors;
+};
+
+namespace expected_detail
+{
+
+template<class Range>
+using partitioned_results_t =
+    partitioned_results<typename range_expected_t<Range>::value_type, typename range_expected_t<Range>::error_type>;
+
+} // namespace expected_detail
+
+/// Splits a range of `expected<T, E>` in a single pass into its values and
+/// its errors with their indices, see `partitioned_results`. The values
+/// are reserved for the whole range if its size is known, and values and
+/// errors are moved from rvalue ranges.
+template<class Range, std::enable_if_t<expected_detail::is_expected_range_v<Range>> * = nullptr>
+auto partition_results(Range &&r)
+{
+    using Result = expected_detail::partitioned_results_t<Range>;
+    using T      = typename expected_detail::range_expected_t<Range>::value_type;
+
+    Result out;
+    if constexpr (!std::is_void_v<T> && expected_detail::is_sized_range_v<Range>)
+    {
+        out.values.reserve(static_cast<std::size_t>(std::size(r)));
+    }
+
+    std::size_t index = 0;
+    for (auto &&e : r)
+    {
+        if (e.has_value())
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                ++out.value_count;
+            }
+            else
+            {
+                out.values.push_back(*expected_detail::forward_element<Range>(e));
+            }
+        }
+        else
+        {
+            out.error_indices.push_back(index);
+            out.errors.push_back(expected_detail::forward_element<Range>(e).error());
+        }
+        ++index;
+    }
+    return out;
+}
+
+/// Parallel `partition_results()` for random access ranges, in two passes:
+/// the workers first count the values of each chunk, then move every
+/// element straight to its final position, so the buffers are allocated
+/// once with their exact size. `T` and `E` must be default constructible.
+template<class Range, std::enable_if_t<expected_detail::is_expected_range_v<Range>> * = nullptr>
+auto partition_results(const parallel_policy &policy, Range &&r)
+{
+    static_assert(expected_detail::is_random_access_range_v<Range>, "the parallel partition_results() requires a random access range");
+
+    using Result = expected_detail::partitioned_results_t<Range>;
+    using T      = typename expected_detail::range_expected_t<Range>::value_type;
+    using E      = typename expected_detail::range_expected_t<Range>::error_type;
+    static_assert(
+        (std::is_void_v<T> || std::is_default_constructible_v<T>) && std::is_default_constructible_v<E>,
+        "the parallel partition_results() requires default constructible values and errors"
+    );
+    // vector<bool> elements of different chunks may share a byte
+    static_assert(!std::is_same_v<T, bool> && !std::is_same_v<E, bool>, "the parallel partition_results() does not support bool");
+
+    auto const                           first = std::begin(r);
+    std::size_t const                    size  = static_cast<std::size_t>(std::size(r));
+    expected_detail::parallel_plan const plan(policy, size);
+    std::size_t const                    chunk_count = (size + plan.chunk_size - 1) / plan.chunk_size;
+
+    auto const element = [&](std::size_t i) -> decltype(auto) { return first[static_cast<std::ptrdiff_t>(i)]; };
+    auto const no_op   = []() noexcept {};
+
+    // first pass: number of values in each chunk
+    std::vector<std::size_t> value_offsets(chunk_count + 1);
+    {
+        expected_detail::chunk_dispenser chunks(size, plan.chunk_size);
+
+        auto count = [&](std::size_t) {
+            std::size_t begin = 0;
+            std::size_t end   = 0;
+            while (chunks.next(begin, end))
+            {
+                std::size_t n = 0;
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    n += element(i).has_value() ? 1 : 0;
+                }
+                value_offsets[begin / plan.chunk_size + 1] = n;
+            }
+        };
+        expected_detail::run_workers(plan.threads, count, no_op);
+    }
+    for (std::size_t c = 0; c < chunk_count; ++c)
+    {
+        value_offsets[c + 1] += value_offsets[c];
+    }
+    std::size_t const value_count = value_offsets[chunk_count];
+
+    Result out;
+    if constexpr (std::is_void_v<T>)
+    {
+        out.value_count = value_count;
+    }
+    else
+    {
+        out.values.resize(value_count);
+    }
+    out.error_indices.resize(size - value_count);
+    out.errors.resize(size - value_count);
+
+    // second pass: every chunk writes to the slots its counts give it
+    {
+        expected_detail::chunk_dispenser chunks(size, plan.chunk_size);
+
+        auto scatter = [&](std::size_t) {
+            std::size_t begin = 0;
+            std::size_t end   = 0;
+            while (chunks.next(begin, end))
+            {
+                std::size_t value_slot = value_offsets[begin / plan.chunk_size];
+                std::size_t error_slot = begin - value_slot;
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    auto &&e = element(i);
+                    if (e.has_value())
+                    {
+                        if constexpr (!std::is_void_v<T>)
+                        {
+                            out.values[value_slot] = *expected_detail::forward_element<Range>(e);
+                        }
+                        ++value_slot;
+                    }
+                    else
+                    {
+                        out.error_indices[error_slot] = i;
+                        out.errors[error_slot]        = expected_detail::forward_element<Range>(e).error();
+                        ++error_slot;
+                    }
+                }
+            }
+        };
+        expected_detail::run_workers(plan.threads, scatter, no_op);
+    }
+    return out;
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
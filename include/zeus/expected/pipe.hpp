@@ -0,0 +1,243 @@
+#ifndef ZEUS_EXPECTED_PIPE_HPP
+#define ZEUS_EXPECTED_PIPE_HPP
+
+#include <tuple>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/lazy.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+template<class U>
+class value_or_adaptor;
+
+template<class Adaptor, class Terminal>
+class terminated_pipe_adaptor;
+
+namespace expected_detail
+{
+
+template<class T>
+inline constexpr bool is_expected_v = is_specialization_v<remove_cvref_t<T>, expected>;
+
+} // namespace expected_detail
+
+/// A composition of monadic stages that is not bound to any `expected` yet.
+///
+///     auto steps = zeus::and_then(parse) | zeus::transform(scale);
+///     auto r     = (e | steps).eval(); // or steps(e)
+///
+/// Composing adaptors only concatenates their stages; applying the result
+/// to an `expected` runs all stages in a single pass (see `lazy_expected`),
+/// so the same composition can be reused across many inputs. An rvalue
+/// `expected` piped into the adaptors is moved into the chain, once per
+/// `|`, so compose the adaptors first where that matters.
+template<class... Stages>
+class pipe_adaptor
+{
+    template<class...>
+    friend class pipe_adaptor;
+
+    using stage_tuple = std::tuple<Stages...>;
+
+public:
+    constexpr explicit pipe_adaptor(stage_tuple stages)
+        : m_stages(std::move(stages))
+    {
+    }
+
+    // evaluated at once, so even an rvalue source is only referred to
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    constexpr auto operator()(Exp &&e) const &
+    {
+        return lazy_expected<Exp &&, Stages...>(std::forward<Exp>(e), m_stages).eval();
+    }
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    constexpr auto operator()(Exp &&e) &&
+    {
+        return lazy_expected<Exp &&, Stages...>(std::forward<Exp>(e), std::move(m_stages)).eval();
+    }
+
+    // expected | adaptor, which moves an rvalue source into the chain
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    friend constexpr lazy_expected<Exp, Stages...> operator|(Exp &&e, const pipe_adaptor &a)
+    {
+        return lazy_expected<Exp, Stages...>(std::forward<Exp>(e), a.m_stages);
+    }
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    friend constexpr lazy_expected<Exp, Stages...> operator|(Exp &&e, pipe_adaptor &&a)
+    {
+        return lazy_expected<Exp, Stages...>(std::forward<Exp>(e), std::move(a.m_stages));
+    }
+
+    // lazy_expected | adaptor
+    template<class Exp, class... Prev>
+    friend constexpr lazy_expected<Exp, Prev..., Stages...> operator|(lazy_expected<Exp, Prev...> &&l, const pipe_adaptor &a)
+    {
+        return bind(std::move(l), a.m_stages);
+    }
+    template<class Exp, class... Prev>
+    friend constexpr lazy_expected<Exp, Prev..., Stages...> operator|(lazy_expected<Exp, Prev...> &&l, pipe_adaptor &&a)
+    {
+        return bind(std::move(l), std::move(a.m_stages));
+    }
+
+    // adaptor | adaptor
+    template<class... More>
+    friend constexpr pipe_adaptor<Stages..., More...> operator|(const pipe_adaptor &lhs, pipe_adaptor<More...> rhs)
+    {
+        return concat(lhs.m_stages, std::move(rhs));
+    }
+    template<class... More>
+    friend constexpr pipe_adaptor<Stages..., More...> operator|(pipe_adaptor &&lhs, pipe_adaptor<More...> rhs)
+    {
+        return concat(std::move(lhs.m_stages), std::move(rhs));
+    }
+
+    // adaptor | value_or(...)
+    template<class U>
+    friend constexpr terminated_pipe_adaptor<pipe_adaptor, value_or_adaptor<U>> operator|(pipe_adaptor lhs, value_or_adaptor<U> rhs)
+    {
+        return terminated_pipe_adaptor<pipe_adaptor, value_or_adaptor<U>>(std::move(lhs), std::move(rhs));
+    }
+
+private:
+    // The friend operators above are not members, so they go through these
+    // to reach the stages of other adaptors and of lazy_expected.
+    template<class Exp, class... Prev>
+    static constexpr lazy_expected<Exp, Prev..., Stages...> bind(lazy_expected<Exp, Prev...> &&l, stage_tuple stages)
+    {
+        return std::move(l).append_all(std::move(stages));
+    }
+
+    template<class... More>
+    static constexpr pipe_adaptor<Stages..., More...> concat(stage_tuple stages, pipe_adaptor<More...> &&rhs)
+    {
+        return pipe_adaptor<Stages..., More...>(std::tuple_cat(std::move(stages), std::move(rhs.m_stages)));
+    }
+
+    stage_tuple m_stages;
+};
+
+/// Terminal adaptor extracting the value, or `v` if there is none.
+template<class U>
+class value_or_adaptor
+{
+public:
+    constexpr explicit value_or_adaptor(U v)
+        : m_value(std::move(v))
+    {
+    }
+
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    constexpr auto operator()(Exp &&e) const &
+    {
+        return std::forward<Exp>(e).value_or(m_value);
+    }
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    constexpr auto operator()(Exp &&e) &&
+    {
+        return std::forward<Exp>(e).value_or(std::move(m_value));
+    }
+
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    friend constexpr auto operator|(Exp &&e, const value_or_adaptor &a)
+    {
+        return a(std::forward<Exp>(e));
+    }
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    friend constexpr auto operator|(Exp &&e, value_or_adaptor &&a)
+    {
+        return std::move(a)(std::forward<Exp>(e));
+    }
+
+    template<class Exp, class... Stages>
+    friend constexpr auto operator|(lazy_expected<Exp, Stages...> &&l, const value_or_adaptor &a)
+    {
+        return a(std::move(l).eval());
+    }
+    template<class Exp, class... Stages>
+    friend constexpr auto operator|(lazy_expected<Exp, Stages...> &&l, value_or_adaptor &&a)
+    {
+        return std::move(a)(std::move(l).eval());
+    }
+
+private:
+    U m_value;
+};
+
+/// A `pipe_adaptor` followed by a terminal adaptor such as `value_or()`.
+template<class Adaptor, class Terminal>
+class terminated_pipe_adaptor
+{
+public:
+    constexpr terminated_pipe_adaptor(Adaptor adaptor, Terminal terminal)
+        : m_adaptor(std::move(adaptor))
+        , m_terminal(std::move(terminal))
+    {
+    }
+
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    constexpr auto operator()(Exp &&e) const &
+    {
+        return m_terminal(m_adaptor(std::forward<Exp>(e)));
+    }
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    constexpr auto operator()(Exp &&e) &&
+    {
+        return std::move(m_terminal)(std::move(m_adaptor)(std::forward<Exp>(e)));
+    }
+
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    friend constexpr auto operator|(Exp &&e, const terminated_pipe_adaptor &a)
+    {
+        return a(std::forward<Exp>(e));
+    }
+    template<class Exp, std::enable_if_t<expected_detail::is_expected_v<Exp>> * = nullptr>
+    friend constexpr auto operator|(Exp &&e, terminated_pipe_adaptor &&a)
+    {
+        return std::move(a)(std::forward<Exp>(e));
+    }
+
+private:
+    Adaptor  m_adaptor;
+    Terminal m_terminal;
+};
+
+template<class F>
+[[nodiscard]] constexpr auto and_then(F &&f)
+{
+    using stage = expected_detail::lazy_stage<expected_detail::and_then_stage_t, std::decay_t<F>>;
+    return pipe_adaptor<stage>(std::tuple<stage> {stage {std::forward<F>(f)}});
+}
+
+template<class F>
+[[nodiscard]] constexpr auto transform(F &&f)
+{
+    using stage = expected_detail::lazy_stage<expected_detail::transform_stage_t, std::decay_t<F>>;
+    return pipe_adaptor<stage>(std::tuple<stage> {stage {std::forward<F>(f)}});
+}
+
+template<class F>
+[[nodiscard]] constexpr auto transform_error(F &&f)
+{
+    using stage = expected_detail::lazy_stage<expected_detail::transform_error_stage_t, std::decay_t<F>>;
+    return pipe_adaptor<stage>(std::tuple<stage> {stage {std::forward<F>(f)}});
+}
+
+template<class F>
+[[nodiscard]] constexpr auto or_else(F &&f)
+{
+    using stage = expected_detail::lazy_stage<expected_detail::or_else_stage_t, std::decay_t<F>>;
+    return pipe_adaptor<stage>(std::tuple<stage> {stage {std::forward<F>(f)}});
+}
+
+template<class U>
+[[nodiscard]] constexpr value_or_adaptor<std::decay_t<U>> value_or(U &&v)
+{
+    return value_or_adaptor<std::decay_t<U>>(std::forward<U>(v));
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
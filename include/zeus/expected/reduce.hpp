@@ -0,0 +1,256 @@
+#ifndef ZEUS_EXPECTED_REDUCE_HPP
+#define ZEUS_EXPECTED_REDUCE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/collect.hpp>
+#include <zeus/expected/parallel.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+// What an element of `Range` contributes to a fold: the value of an
+// expected, or the element itself.
+template<class Range, class Ref>
+constexpr decltype(auto) fold_operand(Ref &&element)
+{
+    if constexpr (is_expected_range_v<Range>)
+    {
+        return *forward_element<Range>(element);
+    }
+    else
+    {
+        return forward_element<Range>(element);
+    }
+}
+
+template<class Range>
+using fold_operand_t = decltype(fold_operand<Range>(std::declval<range_reference_t<Range>>()));
+
+template<class T, bool = is_specialization_v<T, expected>>
+struct error_type_of
+{
+    using type = void;
+};
+
+template<class T>
+struct error_type_of<T, true>
+{
+    using type = typename T::error_type;
+};
+
+// The error of a fold over `Range` with a function returning `R`: that
+// of the elements, of `R`, or of both if they agree.
+template<class Range, class R>
+struct fold_error
+{
+    using range_error = typename error_type_of<range_expected_t<Range>>::type;
+    using step_error  = typename error_type_of<R>::type;
+
+    static_assert(
+        !std::is_void_v<range_error> || !std::is_void_v<step_error>,
+        "fold() and reduce() require a range of expected or a function returning expected"
+    );
+    static_assert(
+        std::is_void_v<range_error> || std::is_void_v<step_error> || std::is_same_v<range_error, step_error>,
+        "the function must fail with the error type of the range"
+    );
+
+    using type = std::conditional_t<std::is_void_v<range_error>, step_error, range_error>;
+};
+
+template<class Range, class Acc, class F>
+using fold_error_t = typename fold_error<Range, remove_cvref_t<std::invoke_result_t<F &, Acc, fold_operand_t<Range>>>>::type;
+
+// Replaces `acc` with `f(std::move(acc), operand)`. If `f` returns an
+// error instead, hands it to `fail` and returns false.
+template<class Acc, class F, class Operand, class Fail>
+bool fold_into(Acc &acc, F &f, Operand &&operand, Fail &&fail)
+{
+    using R = remove_cvref_t<std::invoke_result_t<F &, Acc, Operand>>;
+
+    if constexpr (is_specialization_v<R, expected>)
+    {
+        R next = std::invoke(f, std::move(acc), std::forward<Operand>(operand));
+        if (!next.has_value())
+        {
+            fail(std::move(next).error());
+            return false;
+        }
+        acc = *std::move(next);
+    }
+    else
+    {
+        acc = std::invoke(f, std::move(acc), std::forward<Operand>(operand));
+    }
+    return true;
+}
+
+} // namespace expected_detail
+
+/// Left fold over a range that stops at the first error: `f(acc, x)` is
+/// called for every element `x` of a plain range, or for the value of
+/// every element of a range of `expected<T, E>`, and may itself return
+/// `expected<Acc, E>`. Returns `expected<Acc, E>` holding the final
+/// accumulator or the first error, either from the range or from `f`.
+///
+///     std::vector<zeus::expected<std::uint64_t, io_error>> sizes = stat_all(paths);
+///     zeus::expected<std::uint64_t, io_error> total = zeus::fold(sizes, std::uint64_t {0}, std::plus<>());
+///
+/// Values are moved from rvalue ranges.
+template<class Range, class Acc, class F>
+auto fold(Range &&r, Acc init, F &&f)
+{
+    using E      = expected_detail::fold_error_t<Range, Acc, F>;
+    using Result = expected<Acc, E>;
+
+    std::optional<E> error;
+    auto const       fail = [&error](auto &&g) { error.emplace(std::forward<decltype(g)>(g)); };
+
+    for (auto &&e : r)
+    {
+        if constexpr (expected_detail::is_expected_range_v<Range>)
+        {
+            if (!e.has_value())
+            {
+                return Result(unexpect, expected_detail::forward_element<Range>(e).error());
+            }
+        }
+        if (!expected_detail::fold_into(init, f, expected_detail::fold_operand<Range>(e), fail))
+        {
+            return Result(unexpect, std::move(*error));
+        }
+    }
+    return Result(std::in_place, std::move(init));
+}
+
+/// Parallel `fold()` of a random access range with an associative `op`.
+/// Each chunk of the range (see `parallel_policy`) is folded on its own,
+/// from its first value, then the chunk results are combined pairwise in
+/// a balanced tree and finally folded into `init`. The order of the
+/// operands is kept, so `op` need not be commutative, and `op` must accept
+/// both an element and another accumulator on its right. The values must
+/// be convertible to `T`.
+///
+/// The error returned is the one of the smallest index: the workers skip
+/// the elements past the earliest failure found so far and finish those
+/// before it. Errors of the range are therefore reported the same way
+/// whatever the policy; an error of `op` is attributed to the element it
+/// was folding in, or, while combining the chunks, to the leftmost failing
+/// combination.
+template<class Range, class T, class Op>
+auto reduce(const parallel_policy &policy, Range &&r, T init, Op &&op)
+{
+    static_assert(expected_detail::is_random_access_range_v<Range>, "the parallel reduce() requires a random access range");
+
+    using E      = expected_detail::fold_error_t<Range, T, Op>;
+    using Result = expected<T, E>;
+
+    auto const                           first = std::begin(r);
+    std::size_t const                    size  = static_cast<std::size_t>(std::size(r));
+    expected_detail::parallel_plan const plan(policy, size);
+    expected_detail::chunk_dispenser     chunks(size, plan.chunk_size);
+    expected_detail::earliest_error<E>   error;
+    std::size_t const                    chunk_count = (size + plan.chunk_size - 1) / plan.chunk_size;
+
+    std::vector<std::optional<T>> partials(chunk_count);
+
+    auto const element = [&](std::size_t i) -> decltype(auto) { return first[static_cast<std::ptrdiff_t>(i)]; };
+
+    // records the error of the element `e` at `i`, if it holds one
+    auto const is_error = [&](auto &&e, std::size_t i) {
+        if constexpr (expected_detail::is_expected_range_v<Range>)
+        {
+            if (!e.has_value())
+            {
+                error.record(i, expected_detail::forward_element<Range>(e).error());
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto body = [&](std::size_t) {
+        std::size_t begin = 0;
+        std::size_t end   = 0;
+        while (chunks.next(begin, end) && begin < error.limit())
+        {
+            // the first value of the chunk starts its accumulator, which
+            // stays local until the whole chunk is folded
+            auto &&head = element(begin);
+            if (is_error(head, begin))
+            {
+                continue;
+            }
+            T           acc(expected_detail::fold_operand<Range>(head));
+            std::size_t i      = begin + 1;
+            bool        failed = false;
+            while (!failed && i < end && i < error.limit())
+            {
+                // the limit is read once per block: for every element, it
+                // would slow down cheap operations noticeably
+                std::size_t const block_end = std::min(end, i + 1'024);
+                for (; i < block_end; ++i)
+                {
+                    auto     &&e    = element(i);
+                    auto const fail = [&error, i](auto &&g) { error.record(i, std::forward<decltype(g)>(g)); };
+                    if (is_error(e, i) || !expected_detail::fold_into(acc, op, expected_detail::fold_operand<Range>(e), fail))
+                    {
+                        failed = true;
+                        break;
+                    }
+                }
+            }
+            if (i == end)
+            {
+                partials[begin / plan.chunk_size].emplace(std::move(acc));
+            }
+        }
+    };
+    expected_detail::run_workers(plan.threads, body, [&]() noexcept { error.cancel(); });
+
+    if (error.has_error())
+    {
+        return Result(unexpect, std::move(error).error());
+    }
+
+    std::optional<E> combine_error;
+    auto const       fail = [&combine_error](auto &&g) { combine_error.emplace(std::forward<decltype(g)>(g)); };
+
+    for (std::size_t step = 1; step < chunk_count; step *= 2)
+    {
+        for (std::size_t c = 0; c + step < chunk_count; c += 2 * step)
+        {
+            if (!expected_detail::fold_into(*partials[c], op, std::move(*partials[c + step]), fail))
+            {
+                return Result(unexpect, std::move(*combine_error));
+            }
+        }
+    }
+    if (chunk_count != 0 && !expected_detail::fold_into(init, op, std::move(*partials[0]), fail))
+    {
+        return Result(unexpect, std::move(*combine_error));
+    }
+    return Result(std::in_place, std::move(init));
+}
+
+/// `reduce()` with the default `parallel_policy`.
+template<class Range, class T, class Op>
+auto reduce(Range &&r, T init, Op &&op)
+{
+    return reduce(parallel_policy {}, std::forward<Range>(r), std::move(init), std::forward<Op>(op));
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
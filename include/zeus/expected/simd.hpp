@@ -0,0 +1,172 @@
+#ifndef ZEUS_EXPECTED_SIMD_HPP
+#define ZEUS_EXPECTED_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include <zeus/expected.hpp>
+
+// x86 kernels: SSE2 is part of the x86-64 baseline, AVX2 is selected at
+// run time. Define ZEUS_EXPECTED_SIMD to 0 to always use the scalar loops.
+#ifndef ZEUS_EXPECTED_SIMD
+    #if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+        #define ZEUS_EXPECTED_SIMD 1
+    #else
+        #define ZEUS_EXPECTED_SIMD 0
+    #endif
+#endif
+
+#include <zeus/expected/detail/simd_kernels.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+// The offset of the has-value flag in the storage of expected<T, E>, the
+// same in every element of an array. offsetof is only conditionally
+// supported when T or E is not standard-layout; GCC, Clang and MSVC
+// support it for storage_base, which has no virtual base.
+template<class T, class E>
+struct has_value_offset
+{
+    using storage = storage_base<T, E>;
+
+#if defined(__GNUC__) || defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+    static constexpr std::size_t value = offsetof(storage, m_has_val);
+#if defined(__GNUC__) || defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+
+    static_assert(sizeof(expected<T, E>) == sizeof(storage), "expected<T, E> must be laid out as its storage");
+};
+
+template<class T, class E>
+inline constexpr std::size_t has_value_offset_v = has_value_offset<T, E>::value;
+
+template<class T, class E>
+const unsigned char *first_flag(const expected<T, E> *first) noexcept
+{
+    return reinterpret_cast<const unsigned char *>(first) + has_value_offset_v<T, E>;
+}
+
+template<class Range>
+using contiguous_expected_t = remove_cvref_t<decltype(*std::data(std::declval<Range &>()))>;
+
+template<class Range, class = void>
+inline constexpr bool is_contiguous_expected_range_v = false;
+template<class Range>
+inline constexpr bool
+    is_contiguous_expected_range_v<Range, std::void_t<contiguous_expected_t<Range>, decltype(std::size(std::declval<Range &>()))>> =
+        is_specialization_v<contiguous_expected_t<Range>, expected>;
+
+} // namespace expected_detail
+
+/// Scans over contiguous arrays of `expected` that only read the has-value
+/// flag of each element, at its fixed offset, with SSE2 or AVX2 where
+/// available.
+namespace simd
+{
+
+/// Number of elements of `[first, first + n)` holding a value.
+template<class T, class E>
+std::size_t count_values(const expected<T, E> *first, std::size_t n) noexcept
+{
+    static_assert(expected_detail::has_value_offset_v<T, E> < sizeof(expected<T, E>), "unexpected layout of expected");
+
+    constexpr std::size_t stride     = sizeof(expected<T, E>);
+    constexpr std::size_t after_flag = stride - expected_detail::has_value_offset_v<T, E>;
+    const unsigned char  *flags      = expected_detail::first_flag(first);
+#if ZEUS_EXPECTED_SIMD
+    if (expected_detail::simd_kernels::use_avx2())
+    {
+        return expected_detail::simd_kernels::count_avx2(flags, n, stride, after_flag);
+    }
+    if constexpr (16 % stride == 0)
+    {
+        return expected_detail::simd_kernels::count_sse2(flags, n, stride, after_flag);
+    }
+#endif
+    (void) after_flag;
+    return expected_detail::simd_kernels::count_scalar(flags, n, stride);
+}
+
+/// Index of the first element of `[first, first + n)` holding an error, or
+/// `n` if there is none.
+template<class T, class E>
+std::size_t find_first_error(const expected<T, E> *first, std::size_t n) noexcept
+{
+    static_assert(expected_detail::has_value_offset_v<T, E> < sizeof(expected<T, E>), "unexpected layout of expected");
+
+    constexpr std::size_t stride     = sizeof(expected<T, E>);
+    constexpr std::size_t after_flag = stride - expected_detail::has_value_offset_v<T, E>;
+    const unsigned char  *flags      = expected_detail::first_flag(first);
+#if ZEUS_EXPECTED_SIMD
+    if (expected_detail::simd_kernels::use_avx2())
+    {
+        return expected_detail::simd_kernels::find_error_avx2(flags, n, stride, after_flag);
+    }
+    if constexpr (16 % stride == 0)
+    {
+        return expected_detail::simd_kernels::find_error_sse2(flags, n, stride, after_flag);
+    }
+#endif
+    (void) after_flag;
+    return expected_detail::simd_kernels::find_error_scalar(flags, n, stride);
+}
+
+/// Sets bit `i % 64` of `mask[i / 64]` to `first[i].has_value()` for every
+/// `i < n`. `mask` must hold `(n + 63) / 64` words; the bits past `n` are
+/// cleared.
+template<class T, class E>
+void has_value_mask(const expected<T, E> *first, std::size_t n, std::uint64_t *mask) noexcept
+{
+    static_assert(expected_detail::has_value_offset_v<T, E> < sizeof(expected<T, E>), "unexpected layout of expected");
+
+    constexpr std::size_t stride     = sizeof(expected<T, E>);
+    constexpr std::size_t after_flag = stride - expected_detail::has_value_offset_v<T, E>;
+    const unsigned char  *flags      = expected_detail::first_flag(first);
+
+    for (std::size_t w = 0; w < (n + 63) / 64; ++w)
+    {
+        mask[w] = 0;
+    }
+#if ZEUS_EXPECTED_SIMD
+    if (expected_detail::simd_kernels::use_avx2())
+    {
+        expected_detail::simd_kernels::mask_avx2(flags, n, stride, after_flag, mask);
+        return;
+    }
+#endif
+    (void) after_flag;
+    expected_detail::simd_kernels::mask_scalar(flags, n, stride, mask, 0);
+}
+
+template<class Range, std::enable_if_t<expected_detail::is_contiguous_expected_range_v<Range>> * = nullptr>
+std::size_t count_values(const Range &r) noexcept
+{
+    return count_values(std::data(r), static_cast<std::size_t>(std::size(r)));
+}
+
+template<class Range, std::enable_if_t<expected_detail::is_contiguous_expected_range_v<Range>> * = nullptr>
+std::size_t find_first_error(const Range &r) noexcept
+{
+    return find_first_error(std::data(r), static_cast<std::size_t>(std::size(r)));
+}
+
+template<class Range, std::enable_if_t<expected_detail::is_contiguous_expected_range_v<Range>> * = nullptr>
+void has_value_mask(const Range &r, std::uint64_t *mask) noexcept
+{
+    has_value_mask(std::data(r), static_cast<std::size_t>(std::size(r)), mask);
+}
+
+} // namespace simd
+
+ZEUS_EXPECTED_NS_END
+
+#endif
@@ -0,0 +1,255 @@
+#ifndef ZEUS_EXPECTED_SIMD_EXPECTED_HPP
+#define ZEUS_EXPECTED_SIMD_EXPECTED_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/simd.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+template<class T, std::size_t N, class E>
+class simd_expected;
+
+namespace expected_detail
+{
+
+template<std::size_t N>
+inline constexpr std::uint64_t lane_mask_v = N == 64 ? ~std::uint64_t {0} : (std::uint64_t {1} << N) - 1;
+
+} // namespace expected_detail
+
+/// The results of one computation over `N` lanes, each of which may have
+/// failed on its own: a vector of `N` values, a mask telling which lanes
+/// hold a value, and a vector of `N` errors. Values and errors are kept in
+/// separate arrays so that lane-wise operations compile to vector code.
+///
+///     zeus::simd_expected<std::uint32_t, 16, decode_error> words = decode16(bytes);
+///     auto scaled = words.transform([](std::uint32_t w) { return w * 3u; });
+///     if (scaled.all_ok()) ...
+///
+/// The value of a failed lane and the error of a successful one are
+/// unspecified but always valid objects, value-initialized at first. `T`
+/// and `E` must be trivially copyable and default constructible, and `N`
+/// at most 64.
+template<class T, std::size_t N, class E>
+class simd_expected
+{
+    static_assert(N > 0 && N <= 64, "simd_expected supports 1 to 64 lanes");
+    static_assert(
+        std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>,
+        "simd_expected requires trivially copyable, default constructible values"
+    );
+    static_assert(
+        std::is_trivially_copyable_v<E> && std::is_default_constructible_v<E>,
+        "simd_expected requires trivially copyable, default constructible errors"
+    );
+
+    template<class T2, std::size_t N2, class E2>
+    friend class simd_expected;
+
+public:
+    using value_type = T;
+    using error_type = E;
+    using mask_type  = std::uint64_t;
+
+    /// Mask of the lanes that exist, bit `i` standing for lane `i`.
+    static constexpr mask_type full_mask = expected_detail::lane_mask_v<N>;
+
+    static constexpr std::size_t size() noexcept { return N; }
+
+    /// All lanes hold a value-initialized value.
+    constexpr simd_expected() noexcept = default;
+
+    /// All lanes hold a value.
+    constexpr explicit simd_expected(const std::array<T, N> &values) noexcept
+        : m_values(values)
+    {
+    }
+
+    /// The lanes set in `mask` hold a value, the others fail with `errors`.
+    constexpr simd_expected(const std::array<T, N> &values, mask_type mask, const std::array<E, N> &errors) noexcept
+        : m_values(values)
+        , m_errors(errors)
+        , m_mask(mask & full_mask)
+    {
+    }
+
+    /// The lanes set in `mask` hold a value, the others fail with `error`.
+    simd_expected(const std::array<T, N> &values, mask_type mask, const E &error) noexcept
+        : m_values(values)
+        , m_mask(mask & full_mask)
+    {
+        m_errors.fill(error);
+    }
+
+    /// Packs `N` scalar results.
+    explicit simd_expected(const std::array<expected<T, E>, N> &lanes) noexcept
+    {
+        simd::has_value_mask(lanes.data(), N, &m_mask);
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            if (lanes[i].has_value())
+                m_values[i] = *lanes[i];
+            else
+                m_errors[i] = lanes[i].error();
+        }
+    }
+
+    constexpr bool has_value(std::size_t lane) const noexcept { return ((m_mask >> lane) & 1) != 0; }
+
+    /// Bit `i` is set if lane `i` holds a value; the bits past `N` are clear.
+    constexpr mask_type mask() const noexcept { return m_mask; }
+
+    constexpr const std::array<T, N> &values() const noexcept { return m_values; }
+    constexpr const std::array<E, N> &errors() const noexcept { return m_errors; }
+
+    constexpr void set_value(std::size_t lane, const T &value) noexcept
+    {
+        m_values[lane] = value;
+        m_mask |= mask_type {1} << lane;
+    }
+
+    constexpr void set_error(std::size_t lane, const E &error) noexcept
+    {
+        m_errors[lane] = error;
+        m_mask &= ~(mask_type {1} << lane);
+    }
+
+    constexpr bool all_ok() const noexcept { return m_mask == full_mask; }
+    constexpr bool any_error() const noexcept { return m_mask != full_mask; }
+
+    /// Lane `lane` as a scalar `expected`.
+    constexpr expected<T, E> operator[](std::size_t lane) const noexcept
+    {
+        if (has_value(lane))
+        {
+            return expected<T, E>(std::in_place, m_values[lane]);
+        }
+        return expected<T, E>(unexpect, m_errors[lane]);
+    }
+
+    /// Every lane as a scalar `expected`.
+    std::array<expected<T, E>, N> to_array() const noexcept
+    {
+        std::array<expected<T, E>, N> out {};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            out[i] = (*this)[i];
+        }
+        return out;
+    }
+
+    /// Applies `f` to the value of every lane. To keep the loop free of
+    /// branches, `f` runs on every lane and the failed lanes discard their
+    /// result; they pass `f` the value of the first lane that holds one
+    /// rather than their own, so `f` only ever sees values it would see
+    /// anyway. `f` must be free of side effects, as any vector operation
+    /// would be, and is not called at all if every lane failed.
+    template<class F>
+    auto transform(F &&f) const
+    {
+        using U = expected_detail::remove_cvref_t<std::invoke_result_t<F &, const T &>>;
+
+        if (m_mask == 0)
+        {
+            return simd_expected<U, N, E>({}, 0, m_errors);
+        }
+        return transform(std::forward<F>(f), m_values[first_value_lane()]);
+    }
+
+    /// As `transform(f)`, passing `neutral` to `f` on the failed lanes.
+    template<class F>
+    auto transform(F &&f, const T &neutral) const
+    {
+        using U = expected_detail::remove_cvref_t<std::invoke_result_t<F &, const T &>>;
+
+        std::array<T, N> const in = blend(neutral);
+        simd_expected<U, N, E> out;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            out.m_values[i] = std::invoke(f, in[i]);
+        }
+        out.m_errors = m_errors;
+        out.m_mask   = m_mask;
+        return out;
+    }
+
+    /// Applies `f`, returning `expected<U, E>`, to the value of every lane.
+    /// A lane of the result holds a value if both this lane and `f`
+    /// succeeded; the lanes that had failed keep their error. Like
+    /// `transform(f)`, `f` runs on every lane without branching and the
+    /// failed lanes pass it the value of the first lane that holds one.
+    template<class F>
+    auto and_then(F &&f) const
+    {
+        using R = expected_detail::remove_cvref_t<std::invoke_result_t<F &, const T &>>;
+        static_assert(expected_detail::is_specialization_v<R, expected>, "f must return a specialization of expected");
+
+        if (m_mask == 0)
+        {
+            return simd_expected<typename R::value_type, N, E>({}, 0, m_errors);
+        }
+        return and_then(std::forward<F>(f), m_values[first_value_lane()]);
+    }
+
+    /// As `and_then(f)`, passing `neutral` to `f` on the failed lanes.
+    template<class F>
+    auto and_then(F &&f, const T &neutral) const
+    {
+        using R = expected_detail::remove_cvref_t<std::invoke_result_t<F &, const T &>>;
+        static_assert(expected_detail::is_specialization_v<R, expected>, "f must return a specialization of expected");
+        static_assert(std::is_same_v<typename R::error_type, E>, "f must return an expected with the same error type");
+        using U = typename R::value_type;
+
+        std::array<T, N> const in = blend(neutral);
+        simd_expected<U, N, E> out;
+        mask_type              ok = 0;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            R const    r       = std::invoke(f, in[i]);
+            bool const lane_ok = r.has_value();
+            out.m_values[i]    = r.value_or(U {});
+            out.m_errors[i]    = has_value(i) ? r.error_or(m_errors[i]) : m_errors[i];
+            ok |= mask_type {lane_ok} << i;
+        }
+        out.m_mask = m_mask & ok;
+        return out;
+    }
+
+private:
+    /// The values, with `neutral` in place of those of the failed lanes.
+    constexpr std::array<T, N> blend(const T &neutral) const noexcept
+    {
+        std::array<T, N> in {};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            in[i] = has_value(i) ? m_values[i] : neutral;
+        }
+        return in;
+    }
+
+    /// The lowest lane that holds a value; `m_mask` must not be zero.
+    constexpr std::size_t first_value_lane() const noexcept
+    {
+        std::size_t lane = 0;
+        while (!has_value(lane))
+        {
+            ++lane;
+        }
+        return lane;
+    }
+
+    std::array<T, N> m_values {};
+    std::array<E, N> m_errors {};
+    mask_type        m_mask = full_mask;
+};
+
+ZEUS_EXPECTED_NS_END
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef ZEUS_EXPECTED_TRY_HPP
+#define ZEUS_EXPECTED_TRY_HPP
+
+#include <utility>
+
+#include <zeus/expected.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+// Returned from the enclosing function by ZEUS_EXPECTED_TRY on error.
+// Converts to any `expected<U, G>` by constructing the error directly in
+// the return object, so E is moved (or copied) exactly once instead of
+// once into an `unexpected<E>` and once more out of it.
+template<class E>
+class try_error
+{
+public:
+    constexpr explicit try_error(E &&e) noexcept
+        : m_error(std::forward<E>(e))
+    {
+    }
+
+    try_error(const try_error &)            = delete;
+    try_error &operator=(const try_error &) = delete;
+
+    template<class U, class G, std::enable_if_t<std::is_constructible_v<G, E>> * = nullptr>
+    constexpr operator expected<U, G>() && noexcept(std::is_nothrow_constructible_v<G, E>)
+    {
+        return expected<U, G>(unexpect, std::forward<E>(m_error));
+    }
+
+private:
+    E &&m_error;
+};
+
+template<class Exp>
+constexpr try_error<decltype(std::declval<Exp>().error())> make_try_error(Exp &&e) noexcept
+{
+    return try_error<decltype(std::declval<Exp>().error())>(std::forward<Exp>(e).error());
+}
+
+} // namespace expected_detail
+
+ZEUS_EXPECTED_NS_END
+
+#define ZEUS_EXPECTED_TRY_CONCAT_EX(a, b) a##b
+#define ZEUS_EXPECTED_TRY_CONCAT(a, b)    ZEUS_EXPECTED_TRY_CONCAT_EX(a, b)
+#define ZEUS_EXPECTED_TRY_TMP             ZEUS_EXPECTED_TRY_CONCAT(zeus_expected_try_tmp_, __COUNTER__)
+
+#define ZEUS_EXPECTED_TRY_IMPL(var, expr, tmp)                                            \
+    auto &&tmp = (expr);                                                                  \
+    if (!tmp.has_value())                                                                 \
+        return ::zeus::expected_detail::make_try_error(std::forward<decltype(tmp)>(tmp)); \
+    var = *std::forward<decltype(tmp)>(tmp)
+
+#define ZEUS_EXPECTED_TRY_VOID_IMPL(expr, tmp)                                           \
+    auto &&tmp = (expr);                                                                 \
+    if (!tmp.has_value())                                                                \
+        return ::zeus::expected_detail::make_try_error(std::forward<decltype(tmp)>(tmp))
+
+/// Evaluates `expr`, which must yield an `expected`. If it holds an error,
+/// returns that error from the enclosing function, whose return type must
+/// be an `expected` with a compatible error type. Otherwise initializes the
+/// declaration `var` from the value:
+///
+///     ZEUS_EXPECTED_TRY(auto port, parse_port(text));
+///
+/// The value and the error of a prvalue `expr` are moved exactly once.
+#define ZEUS_EXPECTED_TRY(var, expr) ZEUS_EXPECTED_TRY_IMPL(var, expr, ZEUS_EXPECTED_TRY_TMP)
+
+/// Like ZEUS_EXPECTED_TRY, for an `expr` whose value is discarded or void.
+#define ZEUS_EXPECTED_TRY_VOID(expr) ZEUS_EXPECTED_TRY_VOID_IMPL(expr, ZEUS_EXPECTED_TRY_TMP)
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define ZEUS_EXPECTED_HAS_TRY_VALUE 1
+
+    #define ZEUS_EXPECTED_TRY_VALUE_IMPL(expr, tmp)                                               \
+        __extension__({                                                                           \
+            auto &&tmp = (expr);                                                                  \
+            if (!tmp.has_value())                                                                 \
+                return ::zeus::expected_detail::make_try_error(std::forward<decltype(tmp)>(tmp)); \
+            *std::forward<decltype(tmp)>(tmp);                                                    \
+        })
+
+    /// Expression form of ZEUS_EXPECTED_TRY based on the GCC/Clang statement
+    /// expression extension: `int port = ZEUS_EXPECTED_TRY_VALUE(parse_port(text));`
+    #define ZEUS_EXPECTED_TRY_VALUE(expr) ZEUS_EXPECTED_TRY_VALUE_IMPL(expr, ZEUS_EXPECTED_TRY_TMP)
+#endif
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef ZEUS_EXPECTED_VALIDATE_HPP
+#define ZEUS_EXPECTED_VALIDATE_HPP
+
+#include <cstddef>
+#include <new>
+#include <tuple>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/zip.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+/// A list of up to `N` errors stored inline, without any allocation.
+/// Errors pushed once the list is full are not stored but counted, see
+/// `overflow()`.
+template<class E, std::size_t N>
+class error_list
+{
+    static_assert(N > 0, "error_list must have a capacity of at least one");
+    static_assert(expected_detail::is_error_type_valid_v<E>, "E must be a valid error type");
+
+public:
+    using value_type      = E;
+    using size_type       = std::size_t;
+    using reference       = E &;
+    using const_reference = const E &;
+    using iterator        = E *;
+    using const_iterator  = const E *;
+
+    error_list() noexcept = default;
+
+    error_list(const error_list &rhs) //
+        noexcept(std::is_nothrow_copy_constructible_v<E>)
+        : m_overflow(rhs.m_overflow)
+    {
+        for (const E &e : rhs)
+        {
+            push_back(e);
+        }
+    }
+
+    error_list(error_list &&rhs) //
+        noexcept(std::is_nothrow_move_constructible_v<E>)
+        : m_overflow(rhs.m_overflow)
+    {
+        for (E &e : rhs)
+        {
+            push_back(std::move(e));
+        }
+    }
+
+    error_list &operator=(const error_list &rhs) //
+        noexcept(std::is_nothrow_copy_constructible_v<E>)
+    {
+        if (this != &rhs)
+        {
+            clear();
+            for (const E &e : rhs)
+            {
+                push_back(e);
+            }
+            m_overflow = rhs.m_overflow;
+        }
+        return *this;
+    }
+
+    error_list &operator=(error_list &&rhs) //
+        noexcept(std::is_nothrow_move_constructible_v<E>)
+    {
+        if (this != &rhs)
+        {
+            clear();
+            for (E &e : rhs)
+            {
+                push_back(std::move(e));
+            }
+            m_overflow = rhs.m_overflow;
+        }
+        return *this;
+    }
+
+    ~error_list() { destroy(); }
+
+    // Stores `e` and returns true, or only counts it and returns false if
+    // the list is full.
+    template<class... Args>
+    bool emplace_back(Args &&...args) //
+        noexcept(std::is_nothrow_constructible_v<E, Args...>)
+    {
+        if (m_size == N)
+        {
+            ++m_overflow;
+            return false;
+        }
+        ::new (static_cast<void *>(std::addressof(m_storage[m_size]))) E(std::forward<Args>(args)...);
+        ++m_size;
+        return true;
+    }
+    bool push_back(const E &e) noexcept(std::is_nothrow_copy_constructible_v<E>) { return emplace_back(e); }
+    bool push_back(E &&e) noexcept(std::is_nothrow_move_constructible_v<E>) { return emplace_back(std::move(e)); }
+
+    void clear() noexcept
+    {
+        destroy();
+        m_size     = 0;
+        m_overflow = 0;
+    }
+
+    // number of stored errors
+    [[nodiscard]] constexpr size_type size() const noexcept { return m_size; }
+    [[nodiscard]] static constexpr size_type capacity() noexcept { return N; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return m_size == 0; }
+    // number of errors that did not fit
+    [[nodiscard]] constexpr size_type overflow() const noexcept { return m_overflow; }
+    // number of errors pushed, stored or not
+    [[nodiscard]] constexpr size_type total() const noexcept { return m_size + m_overflow; }
+
+    [[nodiscard]] iterator begin() noexcept { return data(); }
+    [[nodiscard]] const_iterator begin() const noexcept { return data(); }
+    [[nodiscard]] iterator end() noexcept { return data() + m_size; }
+    [[nodiscard]] const_iterator end() const noexcept { return data() + m_size; }
+
+    [[nodiscard]] reference operator[](size_type i) noexcept { return data()[i]; }
+    [[nodiscard]] const_reference operator[](size_type i) const noexcept { return data()[i]; }
+    [[nodiscard]] reference front() noexcept { return data()[0]; }
+    [[nodiscard]] const_reference front() const noexcept { return data()[0]; }
+    [[nodiscard]] reference back() noexcept { return data()[m_size - 1]; }
+    [[nodiscard]] const_reference back() const noexcept { return data()[m_size - 1]; }
+
+    [[nodiscard]] friend bool operator==(const error_list &lhs, const error_list &rhs)
+    {
+        if (lhs.m_size != rhs.m_size || lhs.m_overflow != rhs.m_overflow)
+        {
+            return false;
+        }
+        for (size_type i = 0; i < lhs.m_size; ++i)
+        {
+            if (!(lhs[i] == rhs[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    [[nodiscard]] friend bool operator!=(const error_list &lhs, const error_list &rhs) { return !(lhs == rhs); }
+
+private:
+    struct slot
+    {
+        alignas(E) unsigned char bytes[sizeof(E)];
+    };
+
+    E *data() noexcept { return std::launder(reinterpret_cast<E *>(m_storage)); }
+    const E *data() const noexcept { return std::launder(reinterpret_cast<const E *>(m_storage)); }
+
+    void destroy() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<E>)
+        {
+            for (E &e : *this)
+            {
+                e.~E();
+            }
+        }
+    }
+
+    slot      m_storage[N];
+    size_type m_size     = 0;
+    size_type m_overflow = 0;
+};
+
+namespace expected_detail
+{
+
+template<class List, class Exp>
+void validate_collect(List &errors, Exp &&e)
+{
+    if (!e.has_value())
+    {
+        errors.push_back(std::forward<Exp>(e).error());
+    }
+}
+
+// Builds the error_list inside the returned expected; kept separate from
+// validate() so that the single named return value can be elided.
+template<class Result, class... Exps>
+Result validate_errors(Exps &&...es)
+{
+    Result r(unexpect);
+    (validate_collect(r.error(), std::forward<Exps>(es)), ...);
+    return r;
+}
+
+} // namespace expected_detail
+
+/// Like `zip()`, but instead of stopping at the first error, returns the
+/// errors of all arguments that hold one, in argument order, in an
+/// `error_list<E, N>`. `N` defaults to the number of arguments; if it is
+/// smaller, the errors that do not fit are counted in `overflow()`.
+template<std::size_t N, class... Exps>
+constexpr auto validate(Exps &&...es)
+{
+    using traits = expected_detail::zip_traits<Exps...>;
+    using U      = expected_detail::zip_invoke_result_t<expected_detail::make_value_tuple, Exps...>;
+    using Result = expected<U, error_list<typename traits::error_type, N>>;
+
+    if ((es.has_value() && ...))
+    {
+        return Result(
+            expected_detail::construct_with_invoke_result_t {},
+            [&]() -> U {
+                return std::apply(
+                    expected_detail::make_value_tuple {}, std::tuple_cat(expected_detail::zip_value_ref(std::forward<Exps>(es))...)
+                );
+            }
+        );
+    }
+    return expected_detail::validate_errors<Result>(std::forward<Exps>(es)...);
+}
+
+template<class... Exps>
+constexpr auto validate(Exps &&...es)
+{
+    return validate<sizeof...(Exps)>(std::forward<Exps>(es)...);
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
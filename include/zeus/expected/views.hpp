@@ -0,0 +1,521 @@
+#ifndef ZEUS_EXPECTED_VIEWS_HPP
+#define ZEUS_EXPECTED_VIEWS_HPP
+
+#include <zeus/expected.hpp>
+
+#if ZEUS_EXPECTED_CPLUSPLUS >= 202'002L && __has_include(<ranges>)
+    #include <ranges>
+#endif
+
+#ifndef ZEUS_EXPECTED_HAS_RANGES
+    #if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201'911L
+        #define ZEUS_EXPECTED_HAS_RANGES 1
+    #else
+        #define ZEUS_EXPECTED_HAS_RANGES 0
+    #endif
+#endif
+
+#if ZEUS_EXPECTED_HAS_RANGES
+
+    #include <algorithm>
+    #include <concepts>
+    #include <cstddef>
+    #include <iterator>
+    #include <optional>
+    #include <type_traits>
+    #include <utility>
+
+    #include <zeus/expected/simd.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+template<class R>
+concept expected_range = std::ranges::input_range<R> && is_specialization_v<remove_cvref_t<std::ranges::range_reference_t<R>>, expected>;
+
+// ranges whose elements are references, into which a view can hand out
+// references to the values or errors
+template<class R>
+concept expected_reference_range = expected_range<R> && std::is_reference_v<std::ranges::range_reference_t<R>>;
+
+template<bool Const, class V>
+using maybe_const_t = std::conditional_t<Const, const V, V>;
+
+    #if __cpp_lib_ranges >= 202'202L
+template<class Derived>
+using range_adaptor_closure = std::ranges::range_adaptor_closure<Derived>;
+    #else
+// Makes `r | adaptor` call `adaptor(r)`. Unlike the C++23 base, the
+// adaptors cannot be composed with the standard ones before being applied.
+template<class Derived>
+struct range_adaptor_closure
+{
+    template<std::ranges::viewable_range R>
+        requires std::invocable<const Derived &, R>
+    friend constexpr auto operator|(R &&r, const Derived &self)
+    {
+        return self(std::forward<R>(r));
+    }
+};
+    #endif
+
+struct select_values
+{
+    template<class Exp>
+    static constexpr bool keep(const Exp &e) noexcept
+    {
+        return e.has_value();
+    }
+
+    template<class Exp>
+    static constexpr decltype(auto) get(Exp &&e)
+    {
+        return *std::forward<Exp>(e);
+    }
+};
+
+struct select_errors
+{
+    template<class Exp>
+    static constexpr bool keep(const Exp &e) noexcept
+    {
+        return !e.has_value();
+    }
+
+    template<class Exp>
+    static constexpr decltype(auto) get(Exp &&e)
+    {
+        return std::forward<Exp>(e).error();
+    }
+};
+
+// The values or the errors of a range of expected, as references into its
+// elements. Each element is tested once, when the iterator reaches it, and
+// `begin()` is not cached, so the view is const iterable and borrowed
+// whenever `V` is.
+template<std::ranges::view V, class Selector>
+    requires expected_reference_range<V>
+class selected_view : public std::ranges::view_interface<selected_view<V, Selector>>
+{
+    template<bool Const>
+    class iterator
+    {
+        using base_iterator = std::ranges::iterator_t<maybe_const_t<Const, V>>;
+        using base_sentinel = std::ranges::sentinel_t<maybe_const_t<Const, V>>;
+
+        template<bool>
+        friend class iterator;
+        friend class selected_view;
+
+    public:
+        using iterator_concept = std::conditional_t<
+            std::bidirectional_iterator<base_iterator>,
+            std::bidirectional_iterator_tag,
+            std::conditional_t<std::forward_iterator<base_iterator>, std::forward_iterator_tag, std::input_iterator_tag>>;
+        using reference       = decltype(Selector::get(*std::declval<const base_iterator &>()));
+        using value_type      = remove_cvref_t<reference>;
+        using difference_type = std::iter_difference_t<base_iterator>;
+
+        iterator()
+            requires std::default_initializable<base_iterator>
+        = default;
+
+        constexpr iterator(iterator<!Const> other)
+            requires Const && std::convertible_to<std::ranges::iterator_t<V>, base_iterator>
+                  && std::convertible_to<std::ranges::sentinel_t<V>, base_sentinel>
+            : m_current(std::move(other.m_current))
+            , m_last(std::move(other.m_last))
+        {
+        }
+
+        constexpr reference operator*() const { return Selector::get(*m_current); }
+
+        constexpr iterator &operator++()
+        {
+            ++m_current;
+            skip_forward();
+            return *this;
+        }
+
+        constexpr void operator++(int) { ++*this; }
+
+        constexpr iterator operator++(int)
+            requires std::forward_iterator<base_iterator>
+        {
+            iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        // like `std::ranges::filter_view`, assumes that there is a
+        // selected element before this one
+        constexpr iterator &operator--()
+            requires std::bidirectional_iterator<base_iterator>
+        {
+            do
+            {
+                --m_current;
+            } while (!Selector::keep(*m_current));
+            return *this;
+        }
+
+        constexpr iterator operator--(int)
+            requires std::bidirectional_iterator<base_iterator>
+        {
+            iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        friend constexpr bool operator==(const iterator &lhs, const iterator &rhs)
+            requires std::equality_comparable<base_iterator>
+        {
+            return lhs.m_current == rhs.m_current;
+        }
+
+        friend constexpr bool operator==(const iterator &it, std::default_sentinel_t) { return it.m_current == it.m_last; }
+
+    private:
+        constexpr iterator(base_iterator current, base_sentinel last)
+            : m_current(std::move(current))
+            , m_last(std::move(last))
+        {
+            skip_forward();
+        }
+
+        constexpr void skip_forward()
+        {
+            while (m_current != m_last && !Selector::keep(*m_current))
+            {
+                ++m_current;
+            }
+        }
+
+        base_iterator m_current = base_iterator();
+        base_sentinel m_last    = base_sentinel();
+    };
+
+public:
+    selected_view()
+        requires std::default_initializable<V>
+    = default;
+
+    constexpr explicit selected_view(V base)
+        : m_base(std::move(base))
+    {
+    }
+
+    constexpr V base() const &
+        requires std::copy_constructible<V>
+    {
+        return m_base;
+    }
+
+    constexpr V base() && { return std::move(m_base); }
+
+    constexpr auto begin() { return iterator<false>(std::ranges::begin(m_base), std::ranges::end(m_base)); }
+
+    constexpr auto begin() const
+        requires expected_reference_range<const V>
+    {
+        return iterator<true>(std::ranges::begin(m_base), std::ranges::end(m_base));
+    }
+
+    constexpr auto end()
+    {
+        if constexpr (std::ranges::common_range<V> && std::ranges::forward_range<V>)
+        {
+            return iterator<false>(std::ranges::end(m_base), std::ranges::end(m_base));
+        }
+        else
+        {
+            return std::default_sentinel;
+        }
+    }
+
+    constexpr auto end() const
+        requires expected_reference_range<const V>
+    {
+        if constexpr (std::ranges::common_range<const V> && std::ranges::forward_range<const V>)
+        {
+            return iterator<true>(std::ranges::end(m_base), std::ranges::end(m_base));
+        }
+        else
+        {
+            return std::default_sentinel;
+        }
+    }
+
+private:
+    V m_base = V();
+};
+
+// Index of the first element of `r` holding an error, or its size.
+template<class R>
+constexpr std::ranges::range_difference_t<R> find_error_offset(R &r)
+{
+    if constexpr (is_contiguous_expected_range_v<R &>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return static_cast<std::ranges::range_difference_t<R>>(simd::find_first_error(r));
+        }
+    }
+    auto const first = std::ranges::begin(r);
+    return std::ranges::find_if(first, std::ranges::end(r), [](const auto &e) { return !e.has_value(); }) - first;
+}
+
+} // namespace expected_detail
+
+/// The values of a range of `expected<T, E>`, skipping its errors, as
+/// references into its elements.
+template<class V>
+using values_view = expected_detail::selected_view<V, expected_detail::select_values>;
+
+/// The errors of a range of `expected<T, E>`, skipping its values, as
+/// references into its elements.
+template<class V>
+using errors_view = expected_detail::selected_view<V, expected_detail::select_errors>;
+
+/// The elements of a range of `expected<T, E>` before its first error.
+///
+/// Over sized random access ranges, the view finds that error the first
+/// time its end is needed (with `simd::find_first_error()` for contiguous
+/// arrays) and keeps the iterators of `V`, so it is as sized, random access
+/// and contiguous as `V` itself. A const view keeps that offset as well,
+/// so the first calls to `end()` on a const view shared between threads
+/// must not race. Over other ranges, its sentinel stops at the first error
+/// while iterating.
+template<std::ranges::view V>
+    requires expected_detail::expected_range<V>
+class take_until_error_view : public std::ranges::view_interface<take_until_error_view<V>>
+{
+    template<class Base>
+    static constexpr bool is_bounded = std::ranges::random_access_range<Base> && std::ranges::sized_range<Base>;
+
+    template<bool Const>
+    class sentinel
+    {
+        using base_sentinel = std::ranges::sentinel_t<expected_detail::maybe_const_t<Const, V>>;
+
+    public:
+        sentinel() = default;
+
+        constexpr explicit sentinel(base_sentinel last)
+            : m_last(std::move(last))
+        {
+        }
+
+        friend constexpr bool operator==(const std::ranges::iterator_t<expected_detail::maybe_const_t<Const, V>> &it, const sentinel &s)
+        {
+            return it == s.m_last || !(*it).has_value();
+        }
+
+    private:
+        base_sentinel m_last = base_sentinel();
+    };
+
+public:
+    take_until_error_view()
+        requires std::default_initializable<V>
+    = default;
+
+    constexpr explicit take_until_error_view(V base)
+        : m_base(std::move(base))
+    {
+    }
+
+    constexpr V base() const &
+        requires std::copy_constructible<V>
+    {
+        return m_base;
+    }
+
+    constexpr V base() && { return std::move(m_base); }
+
+    constexpr auto begin() { return std::ranges::begin(m_base); }
+
+    constexpr auto begin() const
+        requires expected_detail::expected_range<const V>
+    {
+        return std::ranges::begin(m_base);
+    }
+
+    constexpr auto end()
+    {
+        if constexpr (is_bounded<V>)
+        {
+            // an offset rather than an iterator stays valid when the view is copied
+            if (!m_length)
+            {
+                m_length = expected_detail::find_error_offset(m_base);
+            }
+            return std::ranges::begin(m_base) + *m_length;
+        }
+        else
+        {
+            return sentinel<false>(std::ranges::end(m_base));
+        }
+    }
+
+    constexpr auto end() const
+        requires expected_detail::expected_range<const V>
+    {
+        if constexpr (is_bounded<const V>)
+        {
+            if (!m_length)
+            {
+                m_length = expected_detail::find_error_offset(m_base);
+            }
+            return std::ranges::begin(m_base) + *m_length;
+        }
+        else
+        {
+            return sentinel<true>(std::ranges::end(m_base));
+        }
+    }
+
+private:
+    V                                                         m_base = V();
+    mutable std::optional<std::ranges::range_difference_t<V>> m_length;
+};
+
+namespace expected_detail
+{
+
+// The value of an expected, or a default stored in the function object
+// (and so in the `transform_view` that holds it). Elements that are
+// lvalues are seen through `const T &`, so neither is copied.
+template<class T>
+class value_or_default
+{
+public:
+    constexpr explicit value_or_default(T default_value)
+        : m_default(std::move(default_value))
+    {
+    }
+
+    template<class Exp>
+    constexpr std::conditional_t<std::is_lvalue_reference_v<Exp>, const T &, T> operator()(Exp &&e) const
+    {
+        if (e.has_value())
+        {
+            return *std::forward<Exp>(e);
+        }
+        return m_default;
+    }
+
+private:
+    T m_default;
+};
+
+struct values_fn : range_adaptor_closure<values_fn>
+{
+    template<std::ranges::viewable_range R>
+        requires expected_reference_range<std::views::all_t<R>>
+    constexpr auto operator()(R &&r) const
+    {
+        return values_view<std::views::all_t<R>>(std::views::all(std::forward<R>(r)));
+    }
+};
+
+struct errors_fn : range_adaptor_closure<errors_fn>
+{
+    template<std::ranges::viewable_range R>
+        requires expected_reference_range<std::views::all_t<R>>
+    constexpr auto operator()(R &&r) const
+    {
+        return errors_view<std::views::all_t<R>>(std::views::all(std::forward<R>(r)));
+    }
+};
+
+struct take_until_error_fn : range_adaptor_closure<take_until_error_fn>
+{
+    template<std::ranges::viewable_range R>
+        requires expected_range<std::views::all_t<R>>
+    constexpr auto operator()(R &&r) const
+    {
+        return take_until_error_view<std::views::all_t<R>>(std::views::all(std::forward<R>(r)));
+    }
+};
+
+template<class U>
+class unwrap_or_closure : public range_adaptor_closure<unwrap_or_closure<U>>
+{
+public:
+    constexpr explicit unwrap_or_closure(U default_value)
+        : m_default(std::move(default_value))
+    {
+    }
+
+    template<std::ranges::viewable_range R>
+        requires expected_range<std::views::all_t<R>>
+    constexpr auto operator()(R &&r) const
+    {
+        using T = typename remove_cvref_t<std::ranges::range_reference_t<R>>::value_type;
+        static_assert(!std::is_void_v<T>, "unwrap_or() requires a range of non-void values");
+
+        return std::ranges::transform_view(std::forward<R>(r), value_or_default<T>(static_cast<T>(m_default)));
+    }
+
+private:
+    U m_default;
+};
+
+struct unwrap_or_fn
+{
+    template<class U>
+    constexpr auto operator()(U &&default_value) const
+    {
+        return unwrap_or_closure<std::decay_t<U>>(std::forward<U>(default_value));
+    }
+
+    template<std::ranges::viewable_range R, class U>
+        requires expected_range<std::views::all_t<R>>
+    constexpr auto operator()(R &&r, U &&default_value) const
+    {
+        return unwrap_or_closure<std::decay_t<U>>(std::forward<U>(default_value))(std::forward<R>(r));
+    }
+};
+
+} // namespace expected_detail
+
+/// Lazy range adaptors over ranges of `expected<T, E>`:
+///
+///     for (Record &r : results | zeus::views::values) ...
+///     double best = std::ranges::max(results | zeus::views::unwrap_or(0.0));
+///
+/// `values` and `errors` skip the other alternative and yield references
+/// into the elements, which must therefore be references themselves.
+/// `take_until_error` stops before the first error (see
+/// `take_until_error_view`), and `unwrap_or(default)` replaces each error
+/// with `default`, keeping the size and the random access of the input.
+namespace views
+{
+
+inline constexpr expected_detail::values_fn           values;
+inline constexpr expected_detail::errors_fn           errors;
+inline constexpr expected_detail::take_until_error_fn take_until_error;
+inline constexpr expected_detail::unwrap_or_fn        unwrap_or;
+
+} // namespace views
+
+ZEUS_EXPECTED_NS_END
+
+namespace std::ranges
+{
+
+template<class V, class Selector>
+inline constexpr bool enable_borrowed_range<ZEUS_EXPECTED_NAMESPACE::expected_detail::selected_view<V, Selector>> =
+    enable_borrowed_range<V>;
+
+template<class V>
+inline constexpr bool enable_borrowed_range<ZEUS_EXPECTED_NAMESPACE::take_until_error_view<V>> = enable_borrowed_range<V>;
+
+} // namespace std::ranges
+
+#endif
+
+#endif
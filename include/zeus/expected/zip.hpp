@@ -0,0 +1,119 @@
+#ifndef ZEUS_EXPECTED_ZIP_HPP
+#define ZEUS_EXPECTED_ZIP_HPP
+
+#include <tuple>
+
+#include <zeus/expected.hpp>
+
+ZEUS_EXPECTED_NS_BEGIN
+
+namespace expected_detail
+{
+
+template<class... Exps>
+struct zip_traits
+{
+    static_assert(sizeof...(Exps) > 0, "zip requires at least one expected");
+    static_assert((is_specialization_v<remove_cvref_t<Exps>, expected> && ...), "zip arguments must be expected objects");
+
+    using error_type = typename remove_cvref_t<std::tuple_element_t<0, std::tuple<Exps...>>>::error_type;
+
+    static_assert(
+        (std::is_same_v<typename remove_cvref_t<Exps>::error_type, error_type> && ...), "zip arguments must have the same error_type"
+    );
+};
+
+// The value of `e` as a one-element tuple of references, or an empty tuple
+// for expected<void, E>, so that void arguments contribute nothing.
+template<class Exp>
+constexpr auto zip_value_ref(Exp &&e) noexcept
+{
+    if constexpr (std::is_void_v<typename remove_cvref_t<Exp>::value_type>)
+    {
+        return std::tuple<> {};
+    }
+    else
+    {
+        return std::forward_as_tuple(*std::forward<Exp>(e));
+    }
+}
+
+template<class F, class... Exps>
+using zip_invoke_result_t =
+    remove_cvref_t<decltype(std::apply(std::declval<F>(), std::tuple_cat(zip_value_ref(std::declval<Exps>())...)))>;
+
+// Only called when at least one argument holds an error.
+template<class Result, class Exp, class... Rest>
+constexpr Result zip_first_error(Exp &&e, Rest &&...rest)
+{
+    if constexpr (sizeof...(Rest) == 0)
+    {
+        return Result(unexpect, std::forward<Exp>(e).error());
+    }
+    else
+    {
+        if (!e.has_value())
+        {
+            return Result(unexpect, std::forward<Exp>(e).error());
+        }
+        return zip_first_error<Result>(std::forward<Rest>(rest)...);
+    }
+}
+
+struct make_value_tuple
+{
+    template<class... Args>
+    constexpr std::tuple<remove_cvref_t<Args>...> operator()(Args &&...args) const
+    {
+        return std::tuple<remove_cvref_t<Args>...>(std::forward<Args>(args)...);
+    }
+};
+
+} // namespace expected_detail
+
+/// Invokes `f` with the values of all arguments and returns its result, or
+/// returns the error of the first argument that holds one (`f` is not
+/// invoked then). Arguments of type `expected<void, E>` contribute no
+/// parameter. Rvalue arguments are forwarded as rvalues, and the result of
+/// `f` is constructed directly inside the returned `expected`.
+///
+/// All arguments must share the same `error_type`.
+template<class F, class... Exps>
+constexpr auto zip_with(F &&f, Exps &&...es)
+{
+    using traits = expected_detail::zip_traits<Exps...>;
+    using U      = expected_detail::zip_invoke_result_t<F, Exps...>;
+    using Result = expected<U, typename traits::error_type>;
+
+    if ((es.has_value() && ...))
+    {
+        auto values = std::tuple_cat(expected_detail::zip_value_ref(std::forward<Exps>(es))...);
+        if constexpr (std::is_void_v<U>)
+        {
+            std::apply(std::forward<F>(f), std::move(values));
+            return Result();
+        }
+        else
+        {
+            return Result(
+                expected_detail::construct_with_invoke_result_t {},
+                [&]() -> U { return std::apply(std::forward<F>(f), std::move(values)); }
+            );
+        }
+    }
+    return expected_detail::zip_first_error<Result>(std::forward<Exps>(es)...);
+}
+
+/// Combines the values of all arguments into `expected<std::tuple<T...>, E>`,
+/// or returns the error of the first argument that holds one. Each value is
+/// copied or moved, depending on the value category of its argument,
+/// exactly once.
+template<class... Exps>
+constexpr auto zip(Exps &&...es)
+{
+    return zip_with(expected_detail::make_value_tuple {}, std::forward<Exps>(es)...);
+}
+
+ZEUS_EXPECTED_NS_END
+
+#endif
@@ -0,0 +1,157 @@
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+std::atomic<std::size_t> g_allocations {0};
+std::atomic<std::size_t> g_deallocations {0};
+
+void* counted_alloc(std::size_t size) noexcept
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* counted_aligned_alloc(std::size_t size, std::align_val_t al) noexcept
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    auto const alignment = static_cast<std::size_t>(al);
+    size                 = (size + alignment - 1) / alignment * alignment;
+#if defined(_MSC_VER)
+    return _aligned_malloc(size == 0 ? alignment : size, alignment);
+#else
+    return std::aligned_alloc(alignment, size == 0 ? alignment : size);
+#endif
+}
+
+void counted_free(void* p) noexcept
+{
+    if (p)
+    {
+        g_deallocations.fetch_add(1, std::memory_order_relaxed);
+        std::free(p);
+    }
+}
+
+void counted_aligned_free(void* p) noexcept
+{
+    if (p)
+    {
+        g_deallocations.fetch_add(1, std::memory_order_relaxed);
+#if defined(_MSC_VER)
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+void* throwing(void* p)
+{
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+} // namespace
+
+namespace allocation_counter
+{
+
+std::size_t allocations() noexcept
+{
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+std::size_t deallocations() noexcept
+{
+    return g_deallocations.load(std::memory_order_relaxed);
+}
+
+} // namespace allocation_counter
+
+void* operator new(std::size_t size)
+{
+    return throwing(counted_alloc(size));
+}
+void* operator new[](std::size_t size)
+{
+    return throwing(counted_alloc(size));
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_alloc(size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_alloc(size);
+}
+void* operator new(std::size_t size, std::align_val_t al)
+{
+    return throwing(counted_aligned_alloc(size, al));
+}
+void* operator new[](std::size_t size, std::align_val_t al)
+{
+    return throwing(counted_aligned_alloc(size, al));
+}
+void* operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept
+{
+    return counted_aligned_alloc(size, al);
+}
+void* operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept
+{
+    return counted_aligned_alloc(size, al);
+}
+
+void operator delete(void* p) noexcept
+{
+    counted_free(p);
+}
+void operator delete[](void* p) noexcept
+{
+    counted_free(p);
+}
+void operator delete(void* p, std::size_t) noexcept
+{
+    counted_free(p);
+}
+void operator delete[](void* p, std::size_t) noexcept
+{
+    counted_free(p);
+}
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    counted_free(p);
+}
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    counted_free(p);
+}
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    counted_aligned_free(p);
+}
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+    counted_aligned_free(p);
+}
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    counted_aligned_free(p);
+}
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    counted_aligned_free(p);
+}
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    counted_aligned_free(p);
+}
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    counted_aligned_free(p);
+}
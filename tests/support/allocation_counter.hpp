@@ -0,0 +1,48 @@
+#ifndef ZEUS_EXPECTED_TESTS_ALLOCATION_COUNTER_HPP
+#define ZEUS_EXPECTED_TESTS_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+#include <utility>
+
+// Counters maintained by the replacement global operator new/delete
+// defined in allocation_counter.cpp. Only available in executables linking
+// the `test_allocation_counter` library.
+namespace allocation_counter
+{
+
+std::size_t allocations() noexcept;
+std::size_t deallocations() noexcept;
+
+// Records the counters on construction and reports the difference.
+class scope
+{
+public:
+    scope() noexcept
+        : m_allocations(allocation_counter::allocations())
+        , m_deallocations(allocation_counter::deallocations())
+    {
+    }
+
+    scope(const scope&)            = delete;
+    scope& operator=(const scope&) = delete;
+
+    std::size_t allocations() const noexcept { return allocation_counter::allocations() - m_allocations; }
+    std::size_t deallocations() const noexcept { return allocation_counter::deallocations() - m_deallocations; }
+
+private:
+    std::size_t m_allocations;
+    std::size_t m_deallocations;
+};
+
+// Returns the number of allocations performed while invoking `f`.
+template<class F>
+std::size_t allocations_during(F&& f)
+{
+    scope s;
+    std::forward<F>(f)();
+    return s.allocations();
+}
+
+} // namespace allocation_counter
+
+#endif
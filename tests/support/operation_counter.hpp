@@ -0,0 +1,120 @@
+#ifndef ZEUS_EXPECTED_TESTS_OPERATION_COUNTER_HPP
+#define ZEUS_EXPECTED_TESTS_OPERATION_COUNTER_HPP
+
+#include <ostream>
+
+// Instrumented value types recording how often they are copied and moved.
+namespace operation_counter
+{
+
+struct counts
+{
+    int copy_constructions = 0;
+    int move_constructions = 0;
+    int copy_assignments   = 0;
+    int move_assignments   = 0;
+
+    friend bool operator==(const counts& lhs, const counts& rhs) noexcept
+    {
+        return lhs.copy_constructions == rhs.copy_constructions && //
+               lhs.move_constructions == rhs.move_constructions && //
+               lhs.copy_assignments == rhs.copy_assignments &&     //
+               lhs.move_assignments == rhs.move_assignments;
+    }
+    friend bool operator!=(const counts& lhs, const counts& rhs) noexcept { return !(lhs == rhs); }
+
+    friend counts operator+(const counts& lhs, const counts& rhs) noexcept
+    {
+        counts c;
+        c.copy_constructions = lhs.copy_constructions + rhs.copy_constructions;
+        c.move_constructions = lhs.move_constructions + rhs.move_constructions;
+        c.copy_assignments   = lhs.copy_assignments + rhs.copy_assignments;
+        c.move_assignments   = lhs.move_assignments + rhs.move_assignments;
+        return c;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const counts& c)
+    {
+        return os << "{copy_ctor: " << c.copy_constructions << ", move_ctor: " << c.move_constructions
+                  << ", copy_assign: " << c.copy_assignments << ", move_assign: " << c.move_assignments << "}";
+    }
+};
+
+// Shorthands for building the expected counts in tests.
+inline counts copies(int constructions, int assignments = 0) noexcept
+{
+    counts c;
+    c.copy_constructions = constructions;
+    c.copy_assignments   = assignments;
+    return c;
+}
+inline counts moves(int constructions, int assignments = 0) noexcept
+{
+    counts c;
+    c.move_constructions = constructions;
+    c.move_assignments   = assignments;
+    return c;
+}
+inline counts none() noexcept
+{
+    return counts {};
+}
+
+// Every instantiation keeps its own counters, so distinct `Tag`s can be
+// used for the value and the error type of the same `expected`.
+template<class Tag, bool NothrowCopy = true, bool NothrowMove = true>
+class counted
+{
+public:
+    static counts& stats() noexcept
+    {
+        static counts c;
+        return c;
+    }
+    static void reset() noexcept { stats() = counts {}; }
+
+    counted(int v = 0) noexcept
+        : value(v)
+    {
+    }
+    counted(const counted& other) noexcept(NothrowCopy)
+        : value(other.value)
+    {
+        ++stats().copy_constructions;
+    }
+    counted(counted&& other) noexcept(NothrowMove)
+        : value(other.value)
+    {
+        other.value = -1;
+        ++stats().move_constructions;
+    }
+    counted& operator=(const counted& other) noexcept(NothrowCopy)
+    {
+        value = other.value;
+        ++stats().copy_assignments;
+        return *this;
+    }
+    counted& operator=(counted&& other) noexcept(NothrowMove)
+    {
+        value       = other.value;
+        other.value = -1;
+        ++stats().move_assignments;
+        return *this;
+    }
+    ~counted() {}
+
+    friend bool operator==(const counted& lhs, const counted& rhs) noexcept { return lhs.value == rhs.value; }
+    friend bool operator!=(const counted& lhs, const counted& rhs) noexcept { return lhs.value != rhs.value; }
+
+    int value;
+};
+
+template<class... Counted>
+void reset() noexcept
+{
+    (Counted::reset(), ...);
+}
+
+} // namespace operation_counter
+
+#endif
@@ -0,0 +1,354 @@
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/context.hpp>
+#include <zeus/expected/coroutine.hpp>
+#include <zeus/expected/validate.hpp>
+
+#include "allocation_counter.hpp"
+
+using namespace zeus;
+using allocation_counter::allocations_during;
+
+namespace
+{
+
+// Allocation-free, but with user-provided special members so that the
+// non-trivial storage and assignment paths are exercised.
+struct NonTrivial
+{
+    int value;
+
+    NonTrivial(int v = 0) noexcept
+        : value(v)
+    {
+    }
+    NonTrivial(const NonTrivial& other) noexcept
+        : value(other.value)
+    {
+    }
+    NonTrivial(NonTrivial&& other) noexcept
+        : value(other.value)
+    {
+        other.value = -1;
+    }
+    NonTrivial& operator=(const NonTrivial& other) noexcept
+    {
+        value = other.value;
+        return *this;
+    }
+    NonTrivial& operator=(NonTrivial&& other) noexcept
+    {
+        value       = other.value;
+        other.value = -1;
+        return *this;
+    }
+    ~NonTrivial() {}
+};
+
+// Allocation-free, with a potentially-throwing move constructor so that
+// swap() has to back up the other alternative.
+struct ThrowingMove
+{
+    int value;
+
+    ThrowingMove(int v = 0) noexcept
+        : value(v)
+    {
+    }
+    ThrowingMove(const ThrowingMove& other) noexcept(false)
+        : value(other.value)
+    {
+    }
+    ThrowingMove(ThrowingMove&& other) noexcept(false)
+        : value(other.value)
+    {
+    }
+    ThrowingMove& operator=(const ThrowingMove&) = default;
+    ThrowingMove& operator=(ThrowingMove&&)      = default;
+    ~ThrowingMove() {}
+};
+
+} // namespace
+
+TEST_CASE("allocation counter observes operator new", "[allocations]")
+{
+    auto const n = allocations_during([] {
+        // volatile keeps the new/delete pair from being elided
+        int* volatile p = new int(42);
+        delete p;
+    });
+    CHECK(n == 1);
+}
+
+TEST_CASE("and_then() does not allocate", "[allocations, monadic]")
+{
+    using Expected = expected<NonTrivial, NonTrivial>;
+
+    auto const f = [](auto&& v) { return Expected(std::in_place, v.value + 1); };
+
+    Expected const    value {std::in_place, 1};
+    Expected const    error {unexpect, 2};
+    std::size_t const n = allocations_during([&] {
+        Expected       lv  = value;
+        Expected const clv = value;
+        Expected       le  = error;
+
+        (void) lv.and_then(f);
+        (void) clv.and_then(f);
+        (void) std::move(lv).and_then(f);
+        (void) std::move(clv).and_then(f);
+        (void) le.and_then(f);
+        (void) std::move(le).and_then(f);
+    });
+    CHECK(n == 0);
+}
+
+TEST_CASE("transform() does not allocate", "[allocations, monadic]")
+{
+    using Expected = expected<NonTrivial, NonTrivial>;
+
+    auto const f = [](auto&& v) { return NonTrivial(v.value + 1); };
+
+    Expected const    value {std::in_place, 1};
+    Expected const    error {unexpect, 2};
+    std::size_t const n = allocations_during([&] {
+        Expected       lv  = value;
+        Expected const clv = value;
+        Expected       le  = error;
+
+        (void) lv.transform(f);
+        (void) clv.transform(f);
+        (void) std::move(lv).transform(f);
+        (void) std::move(clv).transform(f);
+        (void) le.transform(f);
+        (void) std::move(le).transform(f);
+        (void) lv.transform([](auto&&) {});
+    });
+    CHECK(n == 0);
+}
+
+TEST_CASE("transform_error() does not allocate", "[allocations, monadic]")
+{
+    using Expected = expected<NonTrivial, NonTrivial>;
+
+    auto const f = [](auto&& e) { return e.value + 1; };
+
+    Expected const    value {std::in_place, 1};
+    Expected const    error {unexpect, 2};
+    std::size_t const n = allocations_during([&] {
+        Expected       le  = error;
+        Expected const cle = error;
+        Expected       lv  = value;
+
+        (void) le.transform_error(f);
+        (void) cle.transform_error(f);
+        (void) std::move(le).transform_error(f);
+        (void) std::move(cle).transform_error(f);
+        (void) lv.transform_error(f);
+        (void) std::move(lv).transform_error(f);
+    });
+    CHECK(n == 0);
+}
+
+TEST_CASE("or_else() does not allocate", "[allocations, monadic]")
+{
+    using Expected = expected<NonTrivial, NonTrivial>;
+
+    auto const f = [](auto&& e) { return Expected(std::in_place, e.value); };
+
+    Expected const    value {std::in_place, 1};
+    Expected const    error {unexpect, 2};
+    std::size_t const n = allocations_during([&] {
+        Expected       le  = error;
+        Expected const cle = error;
+        Expected       lv  = value;
+
+        (void) le.or_else(f);
+        (void) cle.or_else(f);
+        (void) std::move(le).or_else(f);
+        (void) std::move(cle).or_else(f);
+        (void) lv.or_else(f);
+        (void) std::move(lv).or_else(f);
+    });
+    CHECK(n == 0);
+}
+
+TEST_CASE("void-T monadic operations do not allocate", "[allocations, monadic, void-T]")
+{
+    using Expected = expected<void, NonTrivial>;
+
+    std::size_t const n = allocations_during([&] {
+        Expected v;
+        Expected e {unexpect, 1};
+
+        (void) v.and_then([] { return Expected {}; });
+        (void) e.and_then([] { return Expected {}; });
+        (void) v.transform([] { return 1; });
+        (void) std::move(e).transform([] { return 1; });
+        (void) e.transform_error([](auto&& err) { return err.value; });
+        (void) v.or_else([](auto&&) { return Expected {}; });
+        (void) std::move(e).or_else([](auto&&) { return Expected {}; });
+    });
+    CHECK(n == 0);
+}
+
+TEST_CASE("converting constructors do not allocate", "[allocations, converting-constructors]")
+{
+    expected<int, short> const   value {42};
+    expected<int, short> const   error {unexpect, short {1}};
+    expected<void, short> const  void_error {unexpect, short {1}};
+    unexpected<NonTrivial> const unex {3};
+    std::size_t const            n = allocations_during([&] {
+        expected<long, int>       a {value};
+        expected<long, int>       b {error};
+        expected<NonTrivial, int> c {value};
+        expected<NonTrivial, int> d {expected<int, short> {value}};
+        expected<void, int>       e {void_error};
+        expected<void, int>       f {expected<void, short> {void_error}};
+        expected<int, NonTrivial> g {unex};
+        expected<int, NonTrivial> h {unexpected<NonTrivial> {unex}};
+        expected<NonTrivial, int> i {7};
+        (void) a, (void) b, (void) c, (void) d, (void) e, (void) f, (void) g, (void) h, (void) i;
+    });
+    CHECK(n == 0);
+}
+
+TEST_CASE("assignment does not allocate", "[allocations, assignment]")
+{
+    using Expected = expected<NonTrivial, NonTrivial>;
+
+    std::size_t const n = allocations_during([&] {
+        Expected v {std::in_place, 1};
+        Expected e {unexpect, 2};
+
+        Expected x = v;
+        x          = e;
+        x          = v;
+        x          = std::move(e);
+        x          = NonTrivial {3};
+        x          = unexpected<NonTrivial>(4);
+        x.emplace(5);
+    });
+    CHECK(n == 0);
+}
+
+TEST_CASE("swap() does not allocate", "[allocations, swap]")
+{
+    SECTION("nothrow move")
+    {
+        using Expected = expected<NonTrivial, NonTrivial>;
+
+        std::size_t const n = allocations_during([&] {
+            Expected v1 {std::in_place, 1};
+            Expected v2 {std::in_place, 2};
+            Expected e1 {unexpect, 3};
+            Expected e2 {unexpect, 4};
+
+            v1.swap(v2);
+            v1.swap(e1);
+            e1.swap(v1);
+            e1.swap(e2);
+            swap(v2, e2);
+        });
+        CHECK(n == 0);
+    }
+    SECTION("throwing move of T")
+    {
+        using Expected = expected<ThrowingMove, NonTrivial>;
+
+        std::size_t const n = allocations_during([&] {
+            Expected v {std::in_place, 1};
+            Expected e {unexpect, 2};
+
+            v.swap(e);
+            v.swap(e);
+        });
+        CHECK(n == 0);
+    }
+    SECTION("throwing move of E")
+    {
+        using Expected = expected<NonTrivial, ThrowingMove>;
+
+        std::size_t const n = allocations_during([&] {
+            Expected v {std::in_place, 1};
+            Expected e {unexpect, 2};
+
+            v.swap(e);
+            v.swap(e);
+        });
+        CHECK(n == 0);
+    }
+    SECTION("void-T")
+    {
+        using Expected = expected<void, NonTrivial>;
+
+        std::size_t const n = allocations_during([&] {
+            Expected v;
+            Expected e {unexpect, 2};
+
+            v.swap(e);
+            swap(v, e);
+        });
+        CHECK(n == 0);
+    }
+}
+
+TEST_CASE("validate() does not allocate", "[allocations, validate]")
+{
+    std::size_t const n = allocations_during([] {
+        expected<int, NonTrivial> const a {unexpect, 1};
+        expected<int, NonTrivial> const b {2};
+        expected<int, NonTrivial> const c {unexpect, 3};
+
+        auto const r = zeus::validate(a, b, c);
+        CHECK(r.error().size() == 2);
+        CHECK(zeus::validate(b, b).has_value());
+    });
+    CHECK(n == 0);
+}
+
+TEST_CASE("context chains reuse the arena of the thread", "[allocations, context]")
+{
+    auto const chain = [] {
+        expected<int, context_error<int>> r = unexpected(5);
+        for (int i = 0; i < 10; ++i)
+        {
+            r = std::move(r) | zeus::with_context("while processing a layer");
+        }
+        CHECK(r.error().depth() == 10);
+    };
+    // warm up the arena of this thread
+    chain();
+
+    CHECK(allocations_during(chain) == 0);
+}
+
+#if ZEUS_EXPECTED_HAS_COROUTINES && ZEUS_EXPECTED_COROUTINE_FRAME_POOL
+namespace
+{
+
+expected<int, int> half(int x)
+{
+    if (x % 2 != 0)
+        return unexpected(x);
+    return x / 2;
+}
+
+expected<int, int> quarter(int x)
+{
+    int const h = co_await half(x);
+    co_return co_await half(h);
+}
+
+} // namespace
+
+TEST_CASE("coroutine frames are reused from the frame pool", "[allocations, coroutine]")
+{
+    // warm up the pool of this thread
+    (void) quarter(8);
+
+    CHECK(allocations_during([] { CHECK(quarter(8) == 2); }) == 0);
+    CHECK(allocations_during([] { CHECK(quarter(6) == unexpected(3)); }) == 0);
+}
+#endif
@@ -1,5 +1,6 @@
 #include <string>
 #include <optional>
+#include <utility>
 
 #include <catch2/catch_all.hpp>
 
@@ -296,3 +297,73 @@ TEST_CASE("github issue #97 and #145", "[tl-github-issues]")
         }
     }
 }
+
+TEST_CASE("value_or_else()", "[value_or_else]")
+{
+    using Expected = expected<std::string, int>;
+
+    int        calls    = 0;
+    auto const fallback = [&] {
+        ++calls;
+        return std::string("fallback");
+    };
+
+    Expected const value {"value"};
+    Expected       error {unexpect, 3};
+
+    CHECK(value.value_or_else(fallback) == "value");
+    CHECK(calls == 0);
+    CHECK(error.value_or_else(fallback) == "fallback");
+    CHECK(calls == 1);
+
+    // the error is passed if the callable accepts it
+    CHECK(error.value_or_else([](int& e) { return std::to_string(e); }) == "3");
+    CHECK(std::as_const(error).value_or_else([](const int& e) { return std::to_string(e + 1); }) == "4");
+    CHECK(Expected {unexpect, 5}.value_or_else([](int&& e) { return std::to_string(e); }) == "5");
+    CHECK(Expected {"moved"}.value_or_else(fallback) == "moved");
+
+    // the result of the callable is converted to T
+    CHECK(error.value_or_else([] { return "literal"; }) == "literal");
+}
+
+TEST_CASE("error_or_else()", "[error_or_else]")
+{
+    using Expected = expected<std::string, int>;
+
+    int        calls    = 0;
+    auto const fallback = [&] { return ++calls; };
+
+    Expected const value {"value"};
+    Expected const error {unexpect, 3};
+
+    CHECK(error.error_or_else(fallback) == 3);
+    CHECK(calls == 0);
+    CHECK(value.error_or_else(fallback) == 1);
+    CHECK(value.error_or_else([](const std::string& s) { return static_cast<int>(s.size()); }) == 5);
+    CHECK(Expected {"four"}.error_or_else([](std::string&& s) { return static_cast<int>(s.size()); }) == 4);
+    CHECK(std::move(error).error_or_else(fallback) == 3);
+    CHECK(std::move(value).error_or_else([](const std::string&& s) { return static_cast<int>(s.size()); }) == 5);
+}
+
+TEST_CASE("expected<void, E>::error_or_else()", "[error_or_else, void-T]")
+{
+    using Expected = expected<void, int>;
+
+    int        calls    = 0;
+    auto const fallback = [&] { return ++calls; };
+
+    CHECK(Expected {unexpect, 3}.error_or_else(fallback) == 3);
+    CHECK(calls == 0);
+
+    Expected const value;
+    CHECK(value.error_or_else(fallback) == 1);
+    CHECK(Expected {}.error_or_else(fallback) == 2);
+
+    // every ref-qualification, as for non-void T
+    Expected error {unexpect, 4};
+    Expected ok;
+    CHECK(error.error_or_else(fallback) == 4);
+    CHECK(ok.error_or_else(fallback) == 3);
+    CHECK(std::move(std::as_const(error)).error_or_else(fallback) == 4);
+    CHECK(std::move(std::as_const(ok)).error_or_else(fallback) == 4);
+}
@@ -0,0 +1,161 @@
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/batch.hpp>
+
+#if ZEUS_EXPECTED_HAS_RANGES
+    #include <span>
+#endif
+
+using namespace zeus;
+
+namespace
+{
+
+// a store whose multi_get() fails for the negative keys
+struct store
+{
+    int calls = 0;
+
+    std::vector<expected<std::string, std::string>> multi_get(const std::vector<int> &keys)
+    {
+        ++calls;
+        std::vector<expected<std::string, std::string>> rows;
+        for (int key : keys)
+        {
+            if (key < 0)
+                rows.emplace_back(unexpect, "missing " + std::to_string(key));
+            else
+                rows.emplace_back("row " + std::to_string(key));
+        }
+        return rows;
+    }
+};
+
+} // namespace
+
+TEST_CASE("batch_and_then() calls the batch function once with the values", "[batch]")
+{
+    std::vector<expected<int, std::string>> const keys {1, unexpected<std::string>("bad key"), 2, -3, unexpected<std::string>("empty"), 4};
+
+    store      s;
+    auto const rows = batch_and_then(keys, [&s](std::vector<int> batch) {
+        CHECK(batch == std::vector<int> {1, 2, -3, 4});
+        return s.multi_get(batch);
+    });
+    CHECK(s.calls == 1);
+
+    std::vector<expected<std::string, std::string>> const expected_rows {
+        std::string("row 1"),
+        unexpected<std::string>("bad key"),
+        std::string("row 2"),
+        unexpected<std::string>("missing -3"),
+        unexpected<std::string>("empty"),
+        std::string("row 4"),
+    };
+    CHECK(rows == expected_rows);
+}
+
+TEST_CASE("batch_and_then() skips the call without values", "[batch]")
+{
+    std::list<expected<int, std::string>> const keys {unexpected<std::string>("a"), unexpected<std::string>("b")};
+
+    int        calls = 0;
+    auto const batch = [&calls](const std::vector<int> &values) {
+        ++calls;
+        return std::vector<expected<int, std::string>>(values.size());
+    };
+    auto const rows = batch_and_then(keys, batch);
+    CHECK(calls == 0);
+    REQUIRE(rows.size() == 2);
+    CHECK(rows[1] == unexpected<std::string>("b"));
+
+    CHECK(batch_and_then(std::vector<expected<int, std::string>> {}, batch).empty());
+    CHECK(calls == 0);
+}
+
+TEST_CASE("batch_and_then() with a batch function that may fail as a whole", "[batch]")
+{
+    std::vector<expected<int, std::string>> const keys {1, unexpected<std::string>("bad key"), 2};
+
+    auto const down = [](std::vector<int>) -> expected<std::vector<expected<double, std::string>>, std::string> {
+        return unexpected<std::string>("store down");
+    };
+    auto const rows = batch_and_then(keys, down);
+    CHECK(rows[0] == unexpected<std::string>("store down"));
+    CHECK(rows[1] == unexpected<std::string>("bad key"));
+    CHECK(rows[2] == unexpected<std::string>("store down"));
+
+    auto const up = [](std::vector<int> batch) -> expected<std::vector<expected<double, std::string>>, std::string> {
+        std::vector<expected<double, std::string>> halves;
+        for (int x : batch)
+        {
+            halves.emplace_back(x / 2.0);
+        }
+        return halves;
+    };
+    CHECK(batch_and_then(keys, up)[2] == 1.0);
+}
+
+TEST_CASE("batch_and_then() throws if the batch function returns another number of results", "[batch]")
+{
+    std::vector<expected<int, std::string>> const keys {1, unexpected<std::string>("bad key"), 2};
+
+    auto const short_batch = [](const std::vector<int>& batch) {
+        return std::vector<expected<int, std::string>>(batch.size() - 1);
+    };
+    auto const long_batch = [](const std::vector<int>& batch) {
+        return std::list<expected<int, std::string>>(batch.size() + 1);
+    };
+    CHECK_THROWS_AS(batch_and_then(keys, short_batch), std::length_error);
+    CHECK_THROWS_AS(batch_and_then(keys, long_batch), std::length_error);
+
+    auto const wrapped = [](const std::vector<int>& batch) -> expected<std::vector<expected<int, std::string>>, std::string> {
+        return std::vector<expected<int, std::string>>(batch.size() + 1);
+    };
+    CHECK_THROWS_AS(batch_and_then(keys, wrapped), std::length_error);
+}
+
+TEST_CASE("batch_and_then() moves values and errors out of rvalue ranges", "[batch]")
+{
+    std::vector<expected<std::unique_ptr<int>, std::unique_ptr<int>>> v;
+    v.emplace_back(std::make_unique<int>(1));
+    v.emplace_back(unexpect, std::make_unique<int>(-1));
+    v.emplace_back(std::make_unique<int>(2));
+
+    auto const rows = batch_and_then(std::move(v), [](std::vector<std::unique_ptr<int>> batch) {
+        std::vector<expected<std::unique_ptr<int>, std::unique_ptr<int>>> doubled;
+        for (auto &p : batch)
+        {
+            *p *= 2;
+            doubled.emplace_back(std::move(p));
+        }
+        return doubled;
+    });
+    CHECK(**rows[0] == 2);
+    CHECK(*rows[1].error() == -1);
+    CHECK(**rows[2] == 4);
+}
+
+#if ZEUS_EXPECTED_HAS_RANGES
+TEST_CASE("batch_and_then() copies the results out of a span the batch function returns", "[batch]")
+{
+    std::vector<expected<std::string, std::string>> cache {std::string("row a"), std::string("row b"), std::string("row c")};
+    std::vector<expected<int, std::string>> const   keys {0, unexpected<std::string>("bad key"), 2};
+
+    auto const rows = batch_and_then(keys, [&cache](const std::vector<int>& batch) {
+        return std::span(cache).first(batch.size());
+    });
+    CHECK(*rows[0] == "row a");
+    CHECK(rows[1].error() == "bad key");
+    CHECK(*rows[2] == "row b");
+    CHECK(*cache[0] == "row a");
+    CHECK(*cache[1] == "row b");
+}
+#endif
@@ -0,0 +1,194 @@
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/checked.hpp>
+
+using namespace zeus;
+
+namespace
+{
+
+template<class T>
+constexpr T max_of = std::numeric_limits<T>::max();
+template<class T>
+constexpr T min_of = std::numeric_limits<T>::min();
+
+constexpr auto overflow  = unexpected(overflow_error::overflow);
+constexpr auto underflow = unexpected(overflow_error::underflow);
+
+template<class A, class B, class = void>
+constexpr bool can_add_ranges_v = false;
+template<class A, class B>
+constexpr bool can_add_ranges_v<
+    A,
+    B,
+    std::void_t<decltype(simd::checked_add(std::declval<const A&>(), std::declval<const B&>(), std::declval<std::vector<int>&>()))>> =
+    true;
+
+} // namespace
+
+TEST_CASE("checked_add() and checked_sub()", "[checked]")
+{
+    CHECK(checked_add(2, 3) == 5);
+    CHECK(checked_add(max_of<int>, 1) == overflow);
+    CHECK(checked_add(min_of<int>, -1) == underflow);
+    CHECK(checked_add(max_of<int>, min_of<int>) == -1);
+    CHECK(checked_add(std::uint8_t {200}, std::uint8_t {55}) == std::uint8_t {255});
+    CHECK(checked_add(std::uint8_t {200}, std::uint8_t {56}) == overflow);
+
+    CHECK(checked_sub(std::int64_t {-5}, std::int64_t {3}) == -8);
+    CHECK(checked_sub(min_of<std::int64_t>, std::int64_t {1}) == underflow);
+    CHECK(checked_sub(std::int64_t {0}, min_of<std::int64_t>) == overflow);
+    CHECK(checked_sub(1u, 2u) == underflow);
+    CHECK(checked_sub(2u, 2u) == 0u);
+
+    static_assert(checked_add(1, 2) == 3);
+    static_assert(!checked_add(max_of<short>, short {1}).has_value());
+}
+
+TEST_CASE("checked_mul()", "[checked]")
+{
+    CHECK(checked_mul(-4, 5) == -20);
+    CHECK(checked_mul(max_of<int>, 2) == overflow);
+    CHECK(checked_mul(min_of<int>, -1) == overflow);
+    CHECK(checked_mul(min_of<int>, 1) == min_of<int>);
+    CHECK(checked_mul(max_of<int>, -2) == underflow);
+    CHECK(checked_mul(std::int64_t {1} << 32, std::int64_t {1} << 31) == overflow);
+    CHECK(checked_mul(std::uint64_t {1} << 32, std::uint64_t {1} << 31) == std::uint64_t {1} << 63);
+    CHECK(checked_mul(0u, max_of<unsigned>) == 0u);
+
+    // operands narrower than int must not overflow once promoted
+    static_assert(checked_mul(max_of<std::uint16_t>, max_of<std::uint16_t>) == overflow);
+    static_assert(checked_mul(std::uint16_t {255}, std::uint16_t {257}) == max_of<std::uint16_t>);
+    static_assert(checked_mul(min_of<std::int16_t>, std::int16_t {-1}) == overflow);
+}
+
+TEST_CASE("checked_narrow()", "[checked]")
+{
+    CHECK(checked_narrow<std::uint16_t>(65'535) == std::uint16_t {65'535});
+    CHECK(checked_narrow<std::uint16_t>(65'536) == overflow);
+    CHECK(checked_narrow<std::uint16_t>(-1) == underflow);
+    CHECK(checked_narrow<std::int8_t>(-128) == std::int8_t {-128});
+    CHECK(checked_narrow<std::int8_t>(-129) == underflow);
+    CHECK(checked_narrow<std::int32_t>(std::uint32_t {1} << 31) == overflow);
+    CHECK(checked_narrow<std::uint32_t>(std::int8_t {-1}) == underflow);
+    CHECK(checked_narrow<std::uint8_t>(std::int8_t {127}) == std::uint8_t {127});
+    CHECK(checked_narrow<std::int64_t>(max_of<std::uint64_t>) == overflow);
+    CHECK(checked_narrow<std::uint64_t>(min_of<std::int64_t>) == underflow);
+    CHECK(checked_narrow<std::int64_t>(-7) == -7);
+}
+
+TEMPLATE_TEST_CASE(
+    "simd::checked_add() matches the scalar operation", "[checked, simd]", std::int8_t, std::uint16_t, int, std::uint32_t, std::int64_t
+)
+{
+    using T = TestType;
+
+    // long enough for several blocks and a remainder
+    std::vector<T> a(1'000);
+    std::vector<T> b(1'000);
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        a[i] = static_cast<T>(i % 50);
+        b[i] = static_cast<T>(i % 7);
+    }
+    std::vector<T> out(a.size());
+    REQUIRE(simd::checked_add(a, b, out).has_value());
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        CHECK(out[i] == checked_add(a[i], b[i]));
+    }
+
+    for (std::size_t at : {0, 63, 64, 500, 999})
+    {
+        auto a2   = a;
+        auto b2   = b;
+        a2[at]    = max_of<T>;
+        b2[at]    = T {1};
+        a2.back() = max_of<T>;
+        b2.back() = T {1};
+        CHECK(simd::checked_add(a2, b2, out) == unexpected(first_overflow_index {at, overflow_error::overflow}));
+    }
+}
+
+TEST_CASE("span-level operations report the first overflow", "[checked, simd]")
+{
+    std::vector<int> a(300, 1);
+    std::vector<int> b(300, 2);
+    a[200] = max_of<int>;
+    a[250] = min_of<int>;
+    b[250] = -3;
+
+    std::vector<int> out(300, -1);
+    CHECK(simd::checked_add(a, b, out) == unexpected(first_overflow_index {200, overflow_error::overflow}));
+    // the results before the overflow are written, the rest is untouched
+    CHECK(out[199] == 3);
+    CHECK(out[0] == 3);
+    CHECK(out[200] == -1);
+    CHECK(out[299] == -1);
+
+    a[200] = 1;
+    CHECK(simd::checked_add(a, b, out) == unexpected(first_overflow_index {250, overflow_error::underflow}));
+    CHECK(simd::checked_sub(std::vector<int>(300, 0), a, out) == unexpected(first_overflow_index {250, overflow_error::overflow}));
+
+    std::vector<int> const big(130, 1 << 16);
+    CHECK(simd::checked_mul(big, big, out) == unexpected(first_overflow_index {0, overflow_error::overflow}));
+    std::vector<int> const small(130, -(1 << 15));
+    CHECK(simd::checked_mul(small, small, out).has_value());
+    CHECK(out[129] == 1 << 30);
+
+    std::vector<std::int64_t> wide(200, 1);
+    std::vector<std::int64_t> huge(200, max_of<std::int64_t> / 2);
+    huge[150] = max_of<std::int64_t>;
+    std::vector<std::int64_t> wide_out(200);
+    CHECK(simd::checked_mul(huge, wide, wide_out).has_value());
+    wide[150] = -2;
+    CHECK(simd::checked_mul(huge, wide, wide_out) == unexpected(first_overflow_index {150, overflow_error::underflow}));
+
+    CHECK(simd::checked_add(a.data(), b.data(), out.data(), 0).has_value());
+}
+
+TEST_CASE("span-level operations may write over an operand", "[checked, simd]")
+{
+    std::vector<std::uint32_t> a(100, 10);
+    std::vector<std::uint32_t> b(100, 3);
+    REQUIRE(simd::checked_sub(a, b, a).has_value());
+    CHECK(a[0] == 7);
+    CHECK(a[99] == 7);
+    CHECK(simd::checked_sub(b, a, b) == unexpected(first_overflow_index {0, overflow_error::underflow}));
+    CHECK(b[0] == 3);
+}
+
+TEST_CASE("span-level operations require contiguous ranges of integers", "[checked, simd]")
+{
+    STATIC_REQUIRE(can_add_ranges_v<std::vector<int>, std::array<int, 4>>);
+    STATIC_REQUIRE_FALSE(can_add_ranges_v<std::vector<int>, int>);
+    STATIC_REQUIRE_FALSE(can_add_ranges_v<int, std::vector<int>>);
+    STATIC_REQUIRE_FALSE(can_add_ranges_v<std::vector<int>, std::vector<bool>>);
+}
+
+TEST_CASE("simd::checked_narrow()", "[checked, simd]")
+{
+    std::vector<std::int64_t> in(200);
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+        in[i] = static_cast<std::int64_t>(i) * 400;
+    }
+    std::vector<std::uint16_t> out(200);
+    REQUIRE(simd::checked_narrow(std::vector<std::int64_t>(in.begin(), in.begin() + 150), out).has_value());
+    CHECK(out[149] == 149 * 400);
+    CHECK(simd::checked_narrow(in, out) == unexpected(first_overflow_index {164, overflow_error::overflow}));
+    CHECK(out[163] == 163 * 400);
+
+    in[70] = -1;
+    CHECK(simd::checked_narrow(in, out) == unexpected(first_overflow_index {70, overflow_error::underflow}));
+
+    std::array<std::uint32_t, 3> const unsigned_in {1, 2, std::uint32_t {1} << 31};
+    std::array<std::int32_t, 3>        signed_out {};
+    CHECK(simd::checked_narrow(unsigned_in, signed_out) == unexpected(first_overflow_index {2, overflow_error::overflow}));
+}
@@ -0,0 +1,142 @@
+#include <array>
+#include <forward_list>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/collect.hpp>
+#include <zeus/expected/partition.hpp>
+
+#if ZEUS_EXPECTED_HAS_RANGES
+    #include <ranges>
+    #include <span>
+#endif
+
+#include "operation_counter.hpp"
+
+using namespace zeus;
+
+TEST_CASE("collect() gathers all values", "[collect]")
+{
+    std::vector<expected<int, std::string>> const in {1, 2, 3};
+
+    auto const r = collect(in);
+    static_assert(std::is_same_v<decltype(r), const expected<std::vector<int>, std::string>>);
+    CHECK(r == std::vector<int> {1, 2, 3});
+
+    CHECK(collect(std::vector<expected<int, std::string>> {}) == std::vector<int> {});
+}
+
+TEST_CASE("collect() returns the first error", "[collect]")
+{
+    std::vector<expected<int, std::string>> const in {1, unexpected<std::string>("second"), 3, unexpected<std::string>("fourth")};
+
+    CHECK(collect(in) == unexpected<std::string>("second"));
+}
+
+TEST_CASE("collect() works on other ranges", "[collect]")
+{
+    expected<int, int> const arr[] = {1, 2};
+    CHECK(collect(arr) == std::vector<int> {1, 2});
+
+    std::list<expected<int, int>> const list {3, 4};
+    CHECK(collect(list) == std::vector<int> {3, 4});
+
+    std::forward_list<expected<int, int>> const unsized {5, unexpected(6)};
+    CHECK(collect(unsized) == unexpected(6));
+}
+
+TEST_CASE("collect() reserves for sized ranges", "[collect]")
+{
+    std::vector<expected<int, int>> const in(100, 7);
+
+    auto const r = collect(in);
+    REQUIRE(r.has_value());
+    CHECK(r->size() == 100);
+    CHECK(r->capacity() == 100);
+}
+
+TEST_CASE("collect() moves from rvalue ranges and copies from lvalue ranges", "[collect]")
+{
+    using V = operation_counter::counted<struct collect_value_tag>;
+    using E = operation_counter::counted<struct collect_error_tag>;
+
+    std::vector<expected<V, E>> in(3);
+
+    operation_counter::reset<V, E>();
+    CHECK(collect(in).has_value());
+    CHECK(V::stats().copy_constructions == 3);
+
+    operation_counter::reset<V, E>();
+    CHECK(collect(std::move(in)).has_value());
+    CHECK(V::stats().copy_constructions == 0);
+
+    std::vector<expected<V, E>> bad(1, unexpected<E>(std::in_place));
+    operation_counter::reset<V, E>();
+    CHECK_FALSE(collect(std::move(bad)).has_value());
+    CHECK(E::stats().copy_constructions == 0);
+}
+
+#if ZEUS_EXPECTED_HAS_RANGES
+TEST_CASE("collect() copies from rvalue views of another range", "[collect]")
+{
+    std::vector<expected<std::string, std::string>> in {std::string("first"), std::string("second")};
+
+    CHECK(*collect(std::span(in)) == std::vector<std::string> {"first", "second"});
+    CHECK(*collect(in | std::views::take(1)) == std::vector<std::string> {"first"});
+    CHECK(partition_results(std::span(in)).values.size() == 2);
+    CHECK(*in[0] == "first");
+    CHECK(*in[1] == "second");
+
+    std::vector<expected<std::string, std::string>> bad {unexpected<std::string>("bad")};
+    CHECK(collect(std::span(bad)).error() == "bad");
+    CHECK(bad[0].error() == "bad");
+}
+#endif
+
+TEST_CASE("collect() does not touch the elements after an error", "[collect]")
+{
+    std::vector<expected<std::unique_ptr<int>, int>> in;
+    in.emplace_back(std::make_unique<int>(1));
+    in.emplace_back(unexpect, 2);
+    in.emplace_back(std::make_unique<int>(3));
+
+    CHECK(collect(std::move(in)) == unexpected(2));
+    CHECK(in[0].value() == nullptr);
+    REQUIRE(in[2].value() != nullptr);
+    CHECK(*in[2].value() == 3);
+}
+
+TEST_CASE("collect_into() appends to an existing container", "[collect]")
+{
+    std::vector<int> out {0};
+
+    std::array<expected<int, int>, 2> const good {1, 2};
+    CHECK(collect_into(good, out).has_value());
+    CHECK(out == std::vector<int> {0, 1, 2});
+
+    std::array<expected<int, int>, 3> const bad {3, unexpected(4), 5};
+    CHECK(collect_into(bad, out) == unexpected(4));
+    CHECK(out == std::vector<int> {0, 1, 2, 3});
+
+    std::list<int> list;
+    CHECK(collect_into(good, list).has_value());
+    CHECK(list == std::list<int> {1, 2});
+}
+
+TEST_CASE("collect() of void expecteds", "[collect, void-T]")
+{
+    std::vector<expected<void, int>> in(3);
+
+    auto const ok = collect(in);
+    static_assert(std::is_same_v<decltype(ok), const expected<void, int>>);
+    CHECK(ok.has_value());
+
+    in[1] = unexpected(1);
+    in[2] = unexpected(2);
+    CHECK(collect(in) == unexpected(1));
+}
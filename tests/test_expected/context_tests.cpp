@@ -0,0 +1,205 @@
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/context.hpp>
+#include <zeus/expected/parallel.hpp>
+
+using namespace zeus;
+
+namespace
+{
+
+enum class io_error
+{
+    not_found,
+    denied,
+};
+
+std::vector<std::string_view> messages(const context_error<io_error>& e)
+{
+    std::vector<std::string_view> out;
+    for (std::string_view m : e.context())
+    {
+        out.push_back(m);
+    }
+    return out;
+}
+
+expected<int, io_error> read_block(int id)
+{
+    if (id < 0)
+        return unexpected(io_error::not_found);
+    return id * 2;
+}
+
+expected<int, context_error<io_error>> load_shard(int id)
+{
+    return read_block(id) | with_context("while loading shard");
+}
+
+expected<int, context_error<io_error>> load_table(int id)
+{
+    return load_shard(id) | transform([](int x) { return x + 1; }) | with_context("while loading table");
+}
+
+} // namespace
+
+TEST_CASE("context_error without context", "[context]")
+{
+    context_error<io_error> const e = io_error::denied;
+
+    CHECK(e.error() == io_error::denied);
+    CHECK(e.context().empty());
+    CHECK(e.depth() == 0);
+}
+
+TEST_CASE("with_context() adds messages, outermost first", "[context]")
+{
+    context_error<io_error> e(io_error::not_found);
+    e.with_context("reading header").with_context("while loading shard 12");
+
+    CHECK(e.depth() == 2);
+    CHECK(messages(e) == std::vector<std::string_view> {"while loading shard 12", "reading header"});
+}
+
+TEST_CASE("with_context() copies the message", "[context]")
+{
+    context_error<io_error> e(io_error::not_found);
+    {
+        std::string message = "shard ";
+        message += std::to_string(7);
+        e.with_context(message);
+        message.assign(message.size(), 'x');
+    }
+    CHECK(messages(e) == std::vector<std::string_view> {"shard 7"});
+}
+
+TEST_CASE("with_context adaptor wraps and extends errors", "[context, pipe]")
+{
+    CHECK(load_table(3) == 7);
+
+    auto const r = load_table(-1);
+    REQUIRE_FALSE(r.has_value());
+    CHECK(r.error().error() == io_error::not_found);
+    CHECK(messages(r.error()) == std::vector<std::string_view> {"while loading table", "while loading shard"});
+}
+
+TEST_CASE("context_error interoperates with transform_error and or_else", "[context, monadic]")
+{
+    expected<int, io_error> const bad = unexpected(io_error::denied);
+
+    auto const wrapped = bad.transform_error([](io_error e) { return context_error<io_error>(e).with_context("opening"); });
+    REQUIRE_FALSE(wrapped.has_value());
+    CHECK(messages(wrapped.error()) == std::vector<std::string_view> {"opening"});
+
+    auto const recovered = wrapped.or_else([](const context_error<io_error>& e) -> expected<int, context_error<io_error>> {
+        if (e.error() == io_error::denied)
+            return 0;
+        return unexpected(e);
+    });
+    CHECK(recovered == 0);
+
+    expected<int, context_error<io_error>> const direct = unexpected(io_error::not_found);
+    CHECK(direct.error().error() == io_error::not_found);
+}
+
+TEST_CASE("context_error copies share their messages", "[context]")
+{
+    context_error<io_error> a(io_error::denied);
+    a.with_context("inner");
+
+    context_error<io_error> b = a;
+    b.with_context("outer");
+
+    CHECK(messages(a) == std::vector<std::string_view> {"inner"});
+    CHECK(messages(b) == std::vector<std::string_view> {"outer", "inner"});
+
+    context_error<io_error> c = std::move(b);
+    CHECK(c.depth() == 2);
+
+    a = c;
+    CHECK(a.depth() == 2);
+    c = context_error<io_error>(io_error::not_found);
+    CHECK(c.depth() == 0);
+    CHECK(messages(a) == std::vector<std::string_view> {"outer", "inner"});
+}
+
+TEST_CASE("context arena is reused once all errors are gone", "[context]")
+{
+    const void* first = nullptr;
+    {
+        context_error<io_error> e(io_error::denied);
+        e.with_context("first");
+        first = (*e.context().begin()).data();
+    }
+    context_error<io_error> e(io_error::denied);
+    e.with_context("again");
+    CHECK(static_cast<const void*>((*e.context().begin()).data()) == first);
+}
+
+TEST_CASE("a long-lived context_error does not hold back the arena", "[context]")
+{
+    auto const& arena = expected_detail::context_arena::local();
+
+    context_error<io_error> kept(io_error::not_found);
+    kept.with_context("kept");
+
+    std::size_t const chunks = arena.chunks();
+    std::size_t       depth  = 0;
+    for (int i = 0; i < 100'000; ++i)
+    {
+        context_error<io_error> e(io_error::denied);
+        e.with_context("while reading block").with_context("while loading shard").with_context("while loading table");
+        depth += e.depth();
+    }
+    CHECK(depth == 300'000);
+    CHECK(arena.chunks() <= chunks + 1);
+    CHECK(messages(kept) == std::vector<std::string_view> {"kept"});
+}
+
+TEST_CASE("context messages larger than a chunk", "[context]")
+{
+    std::string const       big(10'000, 'b');
+    context_error<io_error> e(io_error::denied);
+    e.with_context("small").with_context(big).with_context("last");
+
+    auto const m = messages(e);
+    REQUIRE(m.size() == 3);
+    CHECK(m[0] == "last");
+    CHECK(m[1] == big);
+    CHECK(m[2] == "small");
+}
+
+TEST_CASE("context_error may be released by another thread", "[context, parallel]")
+{
+    // the worker threads, and their arenas, are gone before the errors
+    std::vector<int> in(1'000);
+    for (int i = 0; i < 1'000; ++i)
+    {
+        in[static_cast<std::size_t>(i)] = i;
+    }
+    auto const r = parallel_transform(parallel_policy {4, 16}, in, [](int x) -> expected<int, context_error<io_error>> {
+        if (x == 700)
+            return read_block(-1) | with_context("while reading block 700") | with_context("in a worker");
+        return x;
+    });
+    REQUIRE_FALSE(r.has_value());
+    CHECK(messages(r.error()) == std::vector<std::string_view> {"in a worker", "while reading block 700"});
+
+    context_error<io_error> kept(io_error::denied);
+    std::thread             worker([&kept]() {
+        context_error<io_error> e(io_error::not_found);
+        e.with_context("from a thread");
+        kept = e;
+        e.with_context("not shared");
+    });
+    worker.join();
+    CHECK(messages(kept) == std::vector<std::string_view> {"from a thread"});
+    kept.with_context("back on the main thread");
+    CHECK(messages(kept) == std::vector<std::string_view> {"back on the main thread", "from a thread"});
+}
@@ -0,0 +1,119 @@
+#include <zeus/expected/coroutine.hpp>
+
+#if ZEUS_EXPECTED_HAS_COROUTINES
+
+    #include <stdexcept>
+    #include <string>
+
+    #include <catch2/catch_all.hpp>
+
+    #include <zeus/expected.hpp>
+
+    #include "operation_counter.hpp"
+
+using namespace zeus;
+
+namespace
+{
+
+expected<int, std::string> parse_digit(char c)
+{
+    if (c < '0' || c > '9')
+        return unexpected(std::string("not a digit: ") + c);
+    return c - '0';
+}
+
+expected<int, std::string> parse_two_digits(const char* s)
+{
+    int const tens = co_await parse_digit(s[0]);
+    int const ones = co_await parse_digit(s[1]);
+    co_return tens * 10 + ones;
+}
+
+expected<void, std::string> check_digits(const char* s)
+{
+    co_await parse_digit(s[0]);
+    co_await parse_digit(s[1]);
+}
+
+expected<int, std::string> non_negative(int x)
+{
+    if (x < 0)
+        co_await unexpected<std::string>("negative");
+    co_return x;
+}
+
+expected<int, std::string> throws_inside()
+{
+    co_await parse_digit('1');
+    throw std::runtime_error("boom");
+}
+
+struct value_tag;
+struct error_tag;
+using V        = operation_counter::counted<value_tag>;
+using Er       = operation_counter::counted<error_tag>;
+using Expected = expected<V, Er>;
+
+Expected make(bool ok)
+{
+    if (ok)
+        return Expected(std::in_place, 1);
+    return Expected(unexpect, 2);
+}
+
+expected<int, Er> unwrap(bool ok)
+{
+    V v = co_await make(ok);
+    co_return v.value;
+}
+
+} // namespace
+
+TEST_CASE("co_await unwraps the value or returns the error", "[coroutine]")
+{
+    CHECK(parse_two_digits("42") == 42);
+    CHECK(parse_two_digits("x2") == unexpected<std::string>("not a digit: x"));
+    CHECK(parse_two_digits("4y") == unexpected<std::string>("not a digit: y"));
+
+    CHECK(check_digits("12").has_value());
+    CHECK(check_digits("1z") == unexpected<std::string>("not a digit: z"));
+
+    CHECK(non_negative(3) == 3);
+    CHECK(non_negative(-3) == unexpected<std::string>("negative"));
+}
+
+TEST_CASE("co_await on an lvalue leaves it untouched", "[coroutine]")
+{
+    expected<std::string, int> const e {"a string long enough to be allocated on the heap"};
+
+    auto const r = [&]() -> expected<std::size_t, int> {
+        std::string const& s = co_await e;
+        co_return s.size();
+    }();
+    CHECK(r == e->size());
+    CHECK(*e == "a string long enough to be allocated on the heap");
+}
+
+TEST_CASE("exceptions escaping a coroutine reach the caller", "[coroutine]")
+{
+    CHECK_THROWS_AS(throws_inside(), std::runtime_error);
+}
+
+TEST_CASE("co_await operation counts", "[coroutine, operation-counts]")
+{
+    using operation_counter::moves;
+    using operation_counter::none;
+
+    operation_counter::reset<V, Er>();
+    CHECK(unwrap(true) == 1);
+    CHECK(V::stats() == moves(1));
+
+    operation_counter::reset<V, Er>();
+    CHECK(unwrap(false).error().value == 2);
+    CHECK(V::stats() == none());
+    // into the coroutine result, then out of it into the returned expected
+    CHECK(Er::stats() == moves(2));
+}
+
+#endif
@@ -0,0 +1,150 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/deferred.hpp>
+
+using namespace zeus;
+
+TEST_CASE("deferred_expected computes on first access and caches the value", "[deferred]")
+{
+    int  calls = 0;
+    auto d     = deferred_expected([&] {
+        ++calls;
+        return expected<std::string, int>("config");
+    });
+    static_assert(std::is_same_v<decltype(d)::expected_type, expected<std::string, int>>);
+
+    CHECK_FALSE(d.is_ready());
+    CHECK(calls == 0);
+
+    CHECK(d.has_value());
+    CHECK(d.is_ready());
+    CHECK(*d == "config");
+    CHECK(d->size() == 6);
+    CHECK(d.value() == "config");
+    CHECK(d.value_or("other") == "config");
+    CHECK(d.error_or(0) == 0);
+    CHECK(calls == 1);
+}
+
+TEST_CASE("deferred_expected caches failures", "[deferred]")
+{
+    int                     calls = 0;
+    deferred_expected const d([&]() -> expected<int, std::string> {
+        ++calls;
+        return unexpected<std::string>("missing");
+    });
+
+    CHECK_FALSE(d);
+    CHECK(d.error() == "missing");
+    CHECK(d.value_or(3) == 3);
+    CHECK(d.get() == unexpected<std::string>("missing"));
+    CHECK(calls == 1);
+}
+
+TEST_CASE("deferred_expected monadic operations", "[deferred, monadic]")
+{
+    deferred_expected const ok([] { return expected<int, int>(2); });
+    deferred_expected const bad([] { return expected<int, int>(unexpect, 5); });
+
+    CHECK(ok.transform([](int x) { return x * 10; }) == 20);
+    CHECK(ok.and_then([](int x) { return expected<int, int>(unexpect, x); }) == unexpected(2));
+    CHECK(bad.transform_error([](int e) { return e + 1; }) == unexpected(6));
+    CHECK(bad.or_else([](int e) { return expected<int, int>(e); }) == 5);
+}
+
+TEST_CASE("deferred_expected<void, E>", "[deferred, void-T]")
+{
+    int                     calls = 0;
+    deferred_expected const d([&] {
+        ++calls;
+        return expected<void, int>();
+    });
+
+    CHECK(d.has_value());
+    d.value();
+    CHECK(d.transform([] { return 1; }) == 1);
+    CHECK(calls == 1);
+}
+
+TEST_CASE("thread-safe deferred_expected runs F once", "[deferred, thread-safe]")
+{
+    std::atomic<int> calls {0};
+
+    auto const d = make_concurrent_deferred([&] {
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return expected<int, int>(42);
+    });
+
+    std::vector<std::thread> threads;
+    std::atomic<int>         sum {0};
+    for (int i = 0; i < 8; ++i)
+    {
+        threads.emplace_back([&] { sum += *d; });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    CHECK(calls == 1);
+    CHECK(sum == 8 * 42);
+}
+
+TEST_CASE("thread-safe deferred_expected retries after an exception", "[deferred, thread-safe]")
+{
+    int        calls = 0;
+    auto const d     = make_concurrent_deferred([&] {
+        if (++calls == 1)
+            throw std::runtime_error("first call fails");
+        return expected<int, int>(1);
+    });
+
+    CHECK_THROWS_AS(d.get(), std::runtime_error);
+    CHECK_FALSE(d.is_ready());
+    CHECK(d.value() == 1);
+    CHECK(calls == 2);
+}
+
+TEST_CASE("thread-safe deferred_expected wakes the waiters when F throws", "[deferred, thread-safe]")
+{
+    std::atomic<int> calls {0};
+
+    auto const d = make_concurrent_deferred([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (++calls == 1)
+            throw std::runtime_error("first call fails");
+        return expected<int, int>(7);
+    });
+
+    std::vector<std::thread> threads;
+    std::atomic<int>         failures {0};
+    std::atomic<int>         sum {0};
+    for (int i = 0; i < 6; ++i)
+    {
+        threads.emplace_back([&] {
+            try
+            {
+                sum += *d;
+            }
+            catch (const std::runtime_error&)
+            {
+                ++failures;
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    CHECK(calls == 2);
+    CHECK(failures == 1);
+    CHECK(sum == 5 * 7);
+}
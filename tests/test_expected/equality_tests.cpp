@@ -1,3 +1,4 @@
+#include <functional>
 #include <string>
 
 #include <catch2/catch_all.hpp>
@@ -335,3 +336,51 @@ SCENARIO("equality", "[equality]")
         }
     }
 }
+
+namespace
+{
+
+template<class T>
+struct tagged
+{
+};
+using mentions_expected = tagged<expected<int, std::string>>;
+
+template<class T, class U, class = void>
+constexpr bool is_equality_comparable_v = false;
+template<class T, class U>
+constexpr bool is_equality_comparable_v<T, U, std::void_t<decltype(std::declval<const T&>() == std::declval<const U&>())>> = true;
+
+} // namespace
+
+TEST_CASE("comparing with a value does not convert to expected", "[equality]")
+{
+    // ADL finds the comparisons of expected<int, std::string> for
+    // `mentions_expected`, but `long` must not be converted to it
+    STATIC_REQUIRE(!is_equality_comparable_v<long, mentions_expected>);
+    STATIC_REQUIRE(!is_equality_comparable_v<mentions_expected, long>);
+    STATIC_REQUIRE(is_equality_comparable_v<expected<int, std::string>, long>);
+    STATIC_REQUIRE(is_equality_comparable_v<long, expected<int, std::string>>);
+}
+
+TEST_CASE("comparing with a value requires an expected operand", "[equality]")
+{
+    struct derived : expected<int, std::string>
+    {
+        using expected::expected;
+    };
+    STATIC_REQUIRE(is_equality_comparable_v<derived, int>);
+    STATIC_REQUIRE(is_equality_comparable_v<int, derived>);
+    CHECK(derived(3) == 3);
+    CHECK(3 != derived(unexpect, "error"));
+
+    // types only convertible to expected no longer use these comparisons
+    using wrapper = std::reference_wrapper<expected<int, std::string>>;
+    STATIC_REQUIRE(!is_equality_comparable_v<wrapper, int>);
+    STATIC_REQUIRE(!is_equality_comparable_v<int, wrapper>);
+
+    expected<int, std::string> e = 3;
+    wrapper const              w = e;
+    CHECK(w.get() == 3);
+    CHECK(w.get() == expected<int, std::string>(3));
+}
@@ -0,0 +1,225 @@
+#include <zeus/expected/generator.hpp>
+
+#if ZEUS_EXPECTED_HAS_COROUTINES
+
+    #include <iterator>
+    #include <memory>
+    #include <ranges>
+    #include <stdexcept>
+    #include <string>
+    #include <vector>
+
+    #include <catch2/catch_all.hpp>
+
+    #include <zeus/expected.hpp>
+
+    #include "operation_counter.hpp"
+
+using namespace zeus;
+
+namespace
+{
+
+expected_generator<int, std::string> parse_all(std::vector<std::string> inputs)
+{
+    for (const std::string& s : inputs)
+    {
+        if (s.empty())
+            co_yield unexpected<std::string>("empty");
+        else if (s == "!")
+            co_yield expected<int, std::string>(unexpect, "bang");
+        else
+            co_yield std::stoi(s);
+    }
+}
+
+expected_generator<int, int> iota(int n)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        co_yield i;
+    }
+}
+
+} // namespace
+
+static_assert(std::ranges::input_range<expected_generator<int, int>>);
+static_assert(std::is_same_v<std::ranges::range_reference_t<expected_generator<int, int>>, expected<int, int>&>);
+
+TEST_CASE("expected_generator yields values and errors in order", "[generator]")
+{
+    std::vector<expected<int, std::string>> out;
+    for (auto& e : parse_all({"1", "", "3", "!", "5"}))
+    {
+        out.push_back(e);
+    }
+
+    REQUIRE(out.size() == 5);
+    CHECK(out[0] == 1);
+    CHECK(out[1] == unexpected<std::string>("empty"));
+    CHECK(out[2] == 3);
+    CHECK(out[3] == unexpected<std::string>("bang"));
+    CHECK(out[4] == 5);
+}
+
+TEST_CASE("expected_generator is lazy", "[generator]")
+{
+    int  produced = 0;
+    auto gen      = [](int& produced) -> expected_generator<int, int> {
+        for (int i = 0;; ++i)
+        {
+            ++produced;
+            co_yield i;
+        }
+    }(produced);
+    CHECK(produced == 0);
+
+    auto it = gen.begin();
+    CHECK(produced == 1);
+    CHECK(*it == 0);
+    ++it;
+    ++it;
+    CHECK(produced == 3);
+    CHECK(it->value() == 2);
+    CHECK(it != gen.end());
+}
+
+TEST_CASE("expected_generator with no elements", "[generator]")
+{
+    auto gen = iota(0);
+    CHECK(gen.begin() == gen.end());
+}
+
+TEST_CASE("expected_generator stop_at_first_error", "[generator]")
+{
+    std::vector<expected<int, std::string>> out;
+    for (auto& e : parse_all({"1", "2", "", "4"}).stop_at_first_error())
+    {
+        out.push_back(e);
+    }
+
+    REQUIRE(out.size() == 3);
+    CHECK(out[1] == 2);
+    CHECK(out[2] == unexpected<std::string>("empty"));
+
+    int count = 0;
+    for (auto& e : iota(4).stop_at_first_error())
+    {
+        CHECK(e.has_value());
+        ++count;
+    }
+    CHECK(count == 4);
+}
+
+TEST_CASE("expected_generator elements can be moved out", "[generator]")
+{
+    auto gen = []() -> expected_generator<std::unique_ptr<int>, int> {
+        co_yield std::make_unique<int>(1);
+        co_yield unexpected(2);
+        co_yield std::make_unique<int>(3);
+    }();
+
+    std::vector<expected<std::unique_ptr<int>, int>> out;
+    for (auto& e : gen)
+    {
+        out.push_back(std::move(e));
+    }
+    REQUIRE(out.size() == 3);
+    CHECK(**out[0] == 1);
+    CHECK(out[1].error() == 2);
+    CHECK(**out[2] == 3);
+}
+
+TEST_CASE("expected_generator constructs yielded values in place", "[generator]")
+{
+    using counted = operation_counter::counted<struct generator_tag>;
+    operation_counter::reset<counted>();
+
+    auto gen = []() -> expected_generator<counted, int> {
+        co_yield counted {};
+        co_yield unexpected(1);
+    }();
+    for (auto& e : gen)
+    {
+        (void) e;
+    }
+    CHECK(counted::stats() == operation_counter::moves(1));
+}
+
+TEST_CASE("expected_generator copies yielded lvalues", "[generator]")
+{
+    bool intact = false;
+    auto gen    = [](bool& intact) -> expected_generator<std::string, int> {
+        expected<std::string, int> const local("kept");
+        co_yield local;
+        intact = *local == "kept";
+    }(intact);
+
+    for (auto& e : gen)
+    {
+        std::string taken = std::move(*e);
+        CHECK(taken == "kept");
+    }
+    CHECK(intact);
+}
+
+TEST_CASE("expected_generator of void", "[generator, void-T]")
+{
+    auto gen = []() -> expected_generator<void, int> {
+        co_yield expected<void, int>();
+        co_yield unexpected(7);
+    }();
+
+    auto it = gen.begin();
+    CHECK(it->has_value());
+    ++it;
+    CHECK(it->error() == 7);
+    ++it;
+    CHECK(it == gen.end());
+}
+
+TEST_CASE("expected_generator is movable", "[generator]")
+{
+    auto a = iota(3);
+    auto b = std::move(a);
+    a      = iota(2);
+
+    int sum = 0;
+    for (auto& e : b)
+    {
+        sum += *e;
+    }
+    for (auto& e : a)
+    {
+        sum += *e;
+    }
+    CHECK(sum == 4);
+}
+
+TEST_CASE("expected_generator works with std::views", "[generator, ranges]")
+{
+    auto gen   = parse_all({"1", "", "3"});
+    auto twice = gen | std::views::filter([](const auto& e) { return e.has_value(); })
+               | std::views::transform([](const auto& e) { return *e * 2; });
+
+    std::vector<int> out;
+    for (int x : twice)
+    {
+        out.push_back(x);
+    }
+    CHECK(out == std::vector<int> {2, 6});
+}
+
+TEST_CASE("expected_generator rethrows exceptions from the body", "[generator]")
+{
+    auto gen = []() -> expected_generator<int, int> {
+        co_yield 1;
+        throw std::runtime_error("boom");
+    }();
+
+    auto it = gen.begin();
+    CHECK(*it == 1);
+    CHECK_THROWS_AS(++it, std::runtime_error);
+}
+
+#endif
@@ -0,0 +1,143 @@
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <list>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/histogram.hpp>
+#include <zeus/expected/partition.hpp>
+#include <zeus/expected/simd_expected.hpp>
+
+using namespace zeus;
+
+namespace
+{
+
+enum class io_error : std::uint8_t
+{
+    not_found,
+    denied,
+    timeout,
+    corrupt = 9,
+};
+
+std::vector<expected<int, io_error>> results(std::size_t n)
+{
+    std::vector<expected<int, io_error>> v;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i % 10 == 3)
+            v.emplace_back(unexpect, io_error::denied);
+        else if (i % 100 == 7)
+            v.emplace_back(unexpect, io_error::corrupt);
+        else
+            v.emplace_back(static_cast<int>(i));
+    }
+    return v;
+}
+
+} // namespace
+
+TEST_CASE("error_histogram() counts the errors of a range of expected by code", "[histogram]")
+{
+    auto const counts = error_histogram(results(1'000));
+    CHECK(counts[io_error::denied] == 100);
+    CHECK(counts[io_error::corrupt] == 10);
+    CHECK(counts[io_error::not_found] == 0);
+    CHECK(counts.total() == 110);
+    CHECK(counts.counts() == std::vector<std::size_t> {0, 100, 0, 0, 0, 0, 0, 0, 0, 10});
+
+    CHECK(error_histogram(std::vector<expected<int, io_error>> {}).counts().empty());
+    CHECK(error_histogram(results(1'000))[io_error::timeout] == 0);
+
+    // any range, and integer error codes
+    std::list<expected<void, int>> const statuses {{}, unexpected(404), unexpected(500), {}, unexpected(404)};
+    auto const                           by_status = error_histogram(statuses);
+    CHECK(by_status[404] == 2);
+    CHECK(by_status[500] == 1);
+    CHECK(by_status[200] == 0);
+    CHECK(by_status.total() == 3);
+}
+
+TEST_CASE("error_histogram() counts ranges of error codes", "[histogram]")
+{
+    std::deque<io_error> const errors {io_error::timeout, io_error::timeout, io_error::not_found};
+    auto const                 counts = error_histogram(errors);
+    CHECK(counts[io_error::timeout] == 2);
+    CHECK(counts[io_error::not_found] == 1);
+
+    error_counts<io_error> more;
+    more.add(io_error::timeout, 3);
+    more.add(io_error::corrupt);
+    more += counts;
+    CHECK(more[io_error::timeout] == 5);
+    CHECK(more[io_error::corrupt] == 1);
+    CHECK(more.total() == 7);
+}
+
+TEST_CASE("error_histogram() counts negative and large codes apart", "[histogram]")
+{
+    std::vector<expected<void, int>> statuses {unexpected(-1), unexpected(-1), unexpected(3), unexpected(1'000'000), {}};
+    statuses.emplace_back(unexpect, std::numeric_limits<int>::min());
+
+    auto const counts = error_histogram(statuses);
+    CHECK(counts[-1] == 2);
+    CHECK(counts[3] == 1);
+    CHECK(counts[1'000'000] == 1);
+    CHECK(counts[std::numeric_limits<int>::min()] == 1);
+    CHECK(counts[-2] == 0);
+    CHECK(counts.total() == 5);
+    CHECK(counts.counts().size() == 4);
+    CHECK(counts.sparse_counts().size() == 3);
+
+    auto more = counts;
+    more += counts;
+    CHECK(more[-1] == 4);
+    CHECK(more.total() == 10);
+    CHECK(error_histogram(parallel_policy {2, 1}, statuses).sparse_counts() == counts.sparse_counts());
+
+    std::vector<std::uint64_t> const codes {error_counts<std::uint64_t>::dense_limit, ~std::uint64_t {0}, 5};
+    auto const                       by_code = error_histogram(codes);
+    CHECK(by_code[~std::uint64_t {0}] == 1);
+    CHECK(by_code.counts().size() == 6);
+}
+
+TEST_CASE("error_histogram() of the result containers", "[histogram]")
+{
+    auto const v = results(1'000);
+    CHECK(error_histogram(partition_results(v)).counts() == error_histogram(v).counts());
+    CHECK(error_histogram(parallel_policy {3, 50}, partition_results(v)).counts() == error_histogram(v).counts());
+
+    std::array<expected<int, io_error>, 8> lanes {};
+    lanes[1] = unexpected(io_error::timeout);
+    lanes[6] = unexpected(io_error::timeout);
+    lanes[7] = unexpected(io_error::denied);
+    simd_expected<int, 8, io_error> const packed(lanes);
+    auto const                            counts = error_histogram(packed);
+    CHECK(counts[io_error::timeout] == 2);
+    CHECK(counts[io_error::denied] == 1);
+    CHECK(counts.total() == 3);
+
+    std::vector<simd_expected<int, 8, io_error>> const batches(5, packed);
+    CHECK(error_histogram(batches).total() == 15);
+}
+
+TEST_CASE("the parallel error_histogram() matches the sequential one", "[histogram, parallel]")
+{
+    auto const v      = results(10'000);
+    auto const counts = error_histogram(v).counts();
+
+    for (std::size_t threads : {1, 2, 5})
+    {
+        for (std::size_t chunk : {1, 7, 1'000, 20'000})
+        {
+            CHECK(error_histogram(parallel_policy {threads, chunk}, v).counts() == counts);
+        }
+    }
+    CHECK(error_histogram(parallel_policy {}, v).total() == 1'100);
+    CHECK(error_histogram(parallel_policy {4}, std::vector<expected<int, io_error>> {}).total() == 0);
+}
@@ -0,0 +1,183 @@
+// Pins sizeof/alignof of expected<T, E> for representative T/E pairs across
+// all four storage_base specializations, together with the number of bytes
+// wasted on padding. Any layout change has to update this matrix.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/simd.hpp>
+
+using namespace zeus;
+
+namespace
+{
+
+struct Empty
+{
+};
+
+enum class Enum8 : std::uint8_t
+{
+    A,
+    B,
+};
+
+// 5 bytes of data, 3 bytes of tail padding
+struct TailPadded
+{
+    std::int32_t i;
+    char         c;
+};
+
+struct alignas(32) OverAligned
+{
+    char c;
+};
+
+struct NonTrivial
+{
+    std::int32_t i;
+    ~NonTrivial() {}
+};
+
+template<class T>
+inline constexpr std::size_t size_of_v = sizeof(T);
+template<>
+inline constexpr std::size_t size_of_v<void> = 0;
+
+template<class T, class E>
+struct layout_of
+{
+    using Expected = expected<T, E>;
+
+    static constexpr std::size_t size  = sizeof(Expected);
+    static constexpr std::size_t align = alignof(Expected);
+
+    // bytes used neither by the larger alternative nor by the has-value flag
+    static constexpr std::size_t padding = size - std::max(size_of_v<T>, sizeof(E)) - sizeof(bool);
+
+    // the base class chain above storage_base must not add any bytes
+    static constexpr bool storage_only = sizeof(Expected) == sizeof(expected_detail::storage_base<T, E>);
+
+    static constexpr bool is(std::size_t expected_size, std::size_t expected_align, std::size_t expected_padding)
+    {
+        return storage_only && size == expected_size && align == expected_align && padding == expected_padding;
+    }
+};
+
+constexpr std::size_t ptr = sizeof(void*);
+
+// The byte the SIMD scans read as the has-value flag of each element,
+// checked against expected objects holding a value and an error.
+template<class T, class E>
+bool flag_byte_is_has_value()
+{
+    constexpr std::size_t offset = expected_detail::has_value_offset_v<T, E>;
+    static_assert(offset < sizeof(expected<T, E>));
+
+    expected<T, E> const value {};
+    expected<T, E> const error {unexpect};
+    unsigned char        value_flag = 0;
+    unsigned char        error_flag = 0;
+    std::memcpy(&value_flag, reinterpret_cast<const unsigned char*>(&value) + offset, 1);
+    std::memcpy(&error_flag, reinterpret_cast<const unsigned char*>(&error) + offset, 1);
+    return value.has_value() && value_flag == 1 && !error.has_value() && error_flag == 0;
+}
+
+} // namespace
+
+TEST_CASE("layout of trivially destructible expected<T, E>", "[layout]")
+{
+    STATIC_REQUIRE(std::is_trivially_destructible_v<expected<int, int>>);
+
+    STATIC_REQUIRE(layout_of<char, char>::is(2, 1, 0));
+    STATIC_REQUIRE(layout_of<Enum8, Enum8>::is(2, 1, 0));
+    STATIC_REQUIRE(layout_of<std::uint16_t, Enum8>::is(4, 2, 1));
+    STATIC_REQUIRE(layout_of<std::int32_t, std::int32_t>::is(8, 4, 3));
+    STATIC_REQUIRE(layout_of<std::int32_t, Enum8>::is(8, 4, 3));
+    STATIC_REQUIRE(layout_of<Empty, Empty>::is(2, 1, 0));
+    STATIC_REQUIRE(layout_of<Empty, std::int32_t>::is(8, 4, 3));
+    STATIC_REQUIRE(layout_of<std::int32_t, Empty>::is(8, 4, 3));
+    STATIC_REQUIRE(layout_of<void*, Enum8>::is(2 * ptr, ptr, ptr - 1));
+    STATIC_REQUIRE(layout_of<Enum8, void*>::is(2 * ptr, ptr, ptr - 1));
+    // the flag cannot be placed into the tail padding of T
+    STATIC_REQUIRE(layout_of<TailPadded, Enum8>::is(12, 4, 3));
+    STATIC_REQUIRE(layout_of<OverAligned, std::int32_t>::is(64, 32, 31));
+    STATIC_REQUIRE(layout_of<std::int32_t, OverAligned>::is(64, 32, 31));
+}
+
+TEST_CASE("layout of non-trivially destructible expected<T, E>", "[layout]")
+{
+    STATIC_REQUIRE_FALSE(std::is_trivially_destructible_v<expected<NonTrivial, int>>);
+
+    STATIC_REQUIRE(layout_of<NonTrivial, std::int32_t>::is(8, 4, 3));
+    STATIC_REQUIRE(layout_of<std::int32_t, NonTrivial>::is(8, 4, 3));
+    STATIC_REQUIRE(layout_of<NonTrivial, Enum8>::is(8, 4, 3));
+    STATIC_REQUIRE(layout_of<NonTrivial, void*>::is(2 * ptr, ptr, ptr - 1));
+    STATIC_REQUIRE(layout_of<NonTrivial, OverAligned>::is(64, 32, 31));
+}
+
+TEST_CASE("layout of trivially destructible expected<void, E>", "[layout, void-T]")
+{
+    STATIC_REQUIRE(std::is_trivially_destructible_v<expected<void, int>>);
+
+    STATIC_REQUIRE(layout_of<void, char>::is(2, 1, 0));
+    STATIC_REQUIRE(layout_of<void, Enum8>::is(2, 1, 0));
+    STATIC_REQUIRE(layout_of<void, Empty>::is(2, 1, 0));
+    STATIC_REQUIRE(layout_of<void, std::int32_t>::is(8, 4, 3));
+    STATIC_REQUIRE(layout_of<void, void*>::is(2 * ptr, ptr, ptr - 1));
+    STATIC_REQUIRE(layout_of<void, TailPadded>::is(12, 4, 3));
+    STATIC_REQUIRE(layout_of<void, OverAligned>::is(64, 32, 31));
+}
+
+TEST_CASE("layout of non-trivially destructible expected<void, E>", "[layout, void-T]")
+{
+    STATIC_REQUIRE_FALSE(std::is_trivially_destructible_v<expected<void, NonTrivial>>);
+
+    STATIC_REQUIRE(layout_of<void, NonTrivial>::is(8, 4, 3));
+}
+
+TEST_CASE("the has-value flag is where the SIMD scans read it", "[layout, simd]")
+{
+    CHECK(flag_byte_is_has_value<char, char>());
+    CHECK(flag_byte_is_has_value<Enum8, Enum8>());
+    CHECK(flag_byte_is_has_value<std::uint16_t, Enum8>());
+    CHECK(flag_byte_is_has_value<std::int32_t, std::int32_t>());
+    CHECK(flag_byte_is_has_value<std::int32_t, Enum8>());
+    CHECK(flag_byte_is_has_value<Empty, Empty>());
+    CHECK(flag_byte_is_has_value<Empty, std::int32_t>());
+    CHECK(flag_byte_is_has_value<std::int32_t, Empty>());
+    CHECK(flag_byte_is_has_value<void*, Enum8>());
+    CHECK(flag_byte_is_has_value<Enum8, void*>());
+    CHECK(flag_byte_is_has_value<TailPadded, Enum8>());
+    CHECK(flag_byte_is_has_value<OverAligned, std::int32_t>());
+    CHECK(flag_byte_is_has_value<std::int32_t, OverAligned>());
+
+    CHECK(flag_byte_is_has_value<NonTrivial, std::int32_t>());
+    CHECK(flag_byte_is_has_value<std::int32_t, NonTrivial>());
+    CHECK(flag_byte_is_has_value<NonTrivial, Enum8>());
+    CHECK(flag_byte_is_has_value<NonTrivial, void*>());
+    CHECK(flag_byte_is_has_value<NonTrivial, OverAligned>());
+
+    CHECK(flag_byte_is_has_value<void, char>());
+    CHECK(flag_byte_is_has_value<void, Enum8>());
+    CHECK(flag_byte_is_has_value<void, Empty>());
+    CHECK(flag_byte_is_has_value<void, std::int32_t>());
+    CHECK(flag_byte_is_has_value<void, void*>());
+    CHECK(flag_byte_is_has_value<void, TailPadded>());
+    CHECK(flag_byte_is_has_value<void, OverAligned>());
+    CHECK(flag_byte_is_has_value<void, NonTrivial>());
+}
+
+TEST_CASE("layout of unexpected<E>", "[layout]")
+{
+    STATIC_REQUIRE(sizeof(unexpected<std::int32_t>) == sizeof(std::int32_t));
+    STATIC_REQUIRE(sizeof(unexpected<TailPadded>) == sizeof(TailPadded));
+    STATIC_REQUIRE(alignof(unexpected<OverAligned>) == alignof(OverAligned));
+}
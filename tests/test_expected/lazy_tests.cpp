@@ -0,0 +1,173 @@
+#include <string>
+#include <type_traits>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/lazy.hpp>
+
+#include "operation_counter.hpp"
+
+using namespace zeus;
+
+namespace
+{
+
+using Expected = expected<int, std::string>;
+
+Expected half(int x)
+{
+    if (x % 2 != 0)
+        return unexpected<std::string>("odd");
+    return x / 2;
+}
+
+Expected recover(const std::string& e)
+{
+    if (e == "odd!")
+        return -1;
+    return unexpected<std::string>(e);
+}
+
+double scale(int x)
+{
+    return x * 1.5;
+}
+
+std::string shout(const std::string& e)
+{
+    return e + "!";
+}
+
+struct value_tag;
+struct error_tag;
+using V  = operation_counter::counted<value_tag>;
+using Er = operation_counter::counted<error_tag>;
+
+} // namespace
+
+TEST_CASE("lazy() evaluates to the same result as the member chain", "[lazy]")
+{
+    for (int input : {8, 6, 3})
+    {
+        for (bool start_with_error : {false, true})
+        {
+            Expected const e = start_with_error ? Expected(unexpect, "boom") : Expected(input);
+
+            auto const eager = e.and_then(half).and_then(half).transform_error(shout).or_else(recover).transform(scale);
+            auto const lazy  = zeus::lazy(e).and_then(half).and_then(half).transform_error(shout).or_else(recover).transform(scale).eval();
+
+            static_assert(std::is_same_v<decltype(eager), decltype(lazy)>);
+            CHECK(eager == lazy);
+        }
+    }
+}
+
+TEST_CASE("lazy() without stages copies the source", "[lazy]")
+{
+    Expected const e {42};
+    CHECK(zeus::lazy(e).eval() == e);
+}
+
+TEST_CASE("lazy() only invokes the stages of the current alternative", "[lazy]")
+{
+    int value_calls = 0;
+    int error_calls = 0;
+
+    auto const on_value = [&](int x) {
+        ++value_calls;
+        return x + 1;
+    };
+    auto const on_error = [&](const std::string& e) {
+        ++error_calls;
+        return e;
+    };
+
+    Expected const error {unexpect, "boom"};
+    auto const     r = zeus::lazy(error).transform(on_value).transform(on_value).transform_error(on_error).eval();
+    CHECK(r == unexpected<std::string>("boom"));
+    CHECK(value_calls == 0);
+    CHECK(error_calls == 1);
+}
+
+TEST_CASE("lazy() with an lvalue source leaves it untouched", "[lazy]")
+{
+    expected<std::string, int> e {"hello world, long enough to defeat SSO"};
+    auto const r = zeus::lazy(e)
+                       .transform_error([](int x) { return x + 1; })
+                       .transform([](const std::string& s) { return s.size(); })
+                       .eval();
+    CHECK(r == e->size());
+    CHECK(*e == "hello world, long enough to defeat SSO");
+}
+
+TEST_CASE("lazy() on expected<void, E>", "[lazy, void-T]")
+{
+    using VoidExpected = expected<void, int>;
+
+    VoidExpected const ok;
+    VoidExpected const fail {unexpect, 3};
+
+    auto const to_int = [] { return 7; };
+    auto const fix    = [](int e) { return e == 3 ? VoidExpected {} : VoidExpected {unexpect, e}; };
+
+    auto const r1 = zeus::lazy(ok).transform(to_int).eval();
+    CHECK(r1 == 7);
+
+    auto const r2 = zeus::lazy(fail).or_else(fix).transform(to_int).eval();
+    CHECK(r2 == 7);
+
+    auto const r3 = zeus::lazy(fail).transform_error([](int e) { return e * 2; }).eval();
+    static_assert(std::is_same_v<std::remove_const_t<decltype(r3)>, VoidExpected>);
+    CHECK(r3 == unexpected(6));
+
+    auto const r4 = zeus::lazy(VoidExpected {}).and_then([] { return expected<int, int> {1}; }).eval();
+    CHECK(r4 == 1);
+}
+
+TEST_CASE("lazy() copies an lvalue source once instead of once per stage", "[lazy, operation-counts]")
+{
+    using operation_counter::copies;
+    using operation_counter::moves;
+    using CountedExpected = expected<V, Er>;
+
+    auto const keep_error = [](const Er& e) { return e; };
+    auto const recover    = [](const Er& e) { return CountedExpected(std::in_place, e.value); };
+
+    CountedExpected const e {std::in_place, 1};
+    {
+        operation_counter::reset<V, Er>();
+
+        auto const r = e.transform_error(keep_error).or_else(recover).transform_error(keep_error);
+        CHECK(r->value == 1);
+        CHECK(V::stats() == copies(1) + moves(2));
+    }
+    {
+        operation_counter::reset<V, Er>();
+
+        auto const r = zeus::lazy(e).transform_error(keep_error).or_else(recover).transform_error(keep_error).eval();
+        CHECK(r->value == 1);
+        CHECK(V::stats() == copies(1));
+    }
+}
+
+TEST_CASE("lazy() moves an rvalue source into the chain", "[lazy, operation-counts]")
+{
+    using operation_counter::moves;
+    using CountedExpected = expected<V, Er>;
+
+    auto const keep_error = [](Er&& e) { return std::move(e); };
+    auto const bump       = [](V&& v) {
+        v.value += 1;
+        return std::move(v);
+    };
+
+    auto chain = zeus::lazy(CountedExpected(std::in_place, 1)).transform_error(keep_error).transform(bump);
+    operation_counter::reset<V, Er>();
+
+    // the chain owns its source, which outlived the full expression
+    CountedExpected const r = std::move(chain).transform(bump).eval();
+    CHECK(r->value == 3);
+    // one move into the new chain, one out of each transform()
+    CHECK(V::stats() == moves(3));
+}
@@ -87,3 +87,75 @@ TEST_CASE("void-T or_else()", "[monadic, void-T]")
         static_assert(std::is_same_v<std::remove_cv_t<decltype(newVal)>, Expected2>);
     }
 }
+
+TEST_CASE("transform_inplace()", "[monadic, inplace]")
+{
+    using Expected = expected<std::string, int>;
+
+    auto const append = [](std::string& s) { s += "!"; };
+
+    Expected e {"hi"};
+    static_assert(std::is_same_v<decltype(e.transform_inplace(append)), Expected&>);
+    static_assert(std::is_same_v<decltype(std::move(e).transform_inplace(append)), Expected&&>);
+
+    CHECK(&e.transform_inplace(append).transform_inplace(append) == &e);
+    CHECK(*e == "hi!!");
+
+    Expected error {unexpect, 1};
+    error.transform_inplace(append);
+    CHECK(error == unexpected(1));
+
+    Expected const moved = std::move(Expected {"a"}.transform_inplace(append));
+    CHECK(*moved == "a!");
+}
+
+TEST_CASE("and_then_inplace()", "[monadic, inplace]")
+{
+    using Expected = expected<std::string, int>;
+
+    auto const check_size = [](std::string& s) -> expected<void, int> {
+        if (s.size() > 3)
+            return unexpected(static_cast<int>(s.size()));
+        s += "!";
+        return {};
+    };
+
+    Expected e {"ab"};
+    e.and_then_inplace(check_size);
+    CHECK(*e == "ab!");
+    e.and_then_inplace(check_size).and_then_inplace(check_size);
+    CHECK(e == unexpected(4));
+
+    Expected const moved = std::move(Expected {"a"}.and_then_inplace(check_size));
+    CHECK(*moved == "a!");
+}
+
+TEST_CASE("transform_error_inplace()", "[monadic, inplace]")
+{
+    using Expected = expected<int, std::string>;
+
+    auto const annotate = [](std::string& s) { s = "error: " + s; };
+
+    Expected e {unexpect, "x"};
+    e.transform_error_inplace(annotate);
+    CHECK(e == unexpected<std::string>("error: x"));
+
+    Expected value {1};
+    value.transform_error_inplace(annotate);
+    CHECK(value == 1);
+}
+
+TEST_CASE("void-T in-place monadic operations", "[monadic, inplace, void-T]")
+{
+    using Expected = expected<void, int>;
+
+    int        calls = 0;
+    auto const count = [&] { ++calls; };
+    auto const fail  = []() -> Expected { return unexpected(5); };
+    auto const bump  = [](int& e) { ++e; };
+
+    Expected e;
+    e.transform_inplace(count).and_then_inplace(fail).transform_inplace(count).transform_error_inplace(bump);
+    CHECK(calls == 1);
+    CHECK(e == unexpected(6));
+}
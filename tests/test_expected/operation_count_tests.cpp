@@ -0,0 +1,594 @@
+// Pins the exact number of copies and moves of T and E performed by each
+// operation, so that extra temporaries cannot creep in unnoticed.
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+
+#include "operation_counter.hpp"
+
+using namespace zeus;
+using operation_counter::copies;
+using operation_counter::counted;
+using operation_counter::moves;
+using operation_counter::none;
+
+namespace
+{
+
+struct value_tag;
+struct error_tag;
+
+using V  = counted<value_tag>;
+using Er = counted<error_tag>;
+
+// T that may throw when copied, but is nothrow movable
+using VThrowingCopy = counted<value_tag, false, true>;
+// T that may throw when copied or moved
+using VThrowing = counted<value_tag, false, false>;
+// E that may throw when copied or moved
+using ErThrowing = counted<error_tag, false, false>;
+
+template<class T, class E>
+struct fixture
+{
+    using Expected = expected<T, E>;
+
+    Expected value {std::in_place, 1};
+    Expected error {unexpect, 2};
+
+    fixture() { operation_counter::reset<T, E>(); }
+};
+
+} // namespace
+
+TEST_CASE("construction operation counts", "[operation-counts, constructors]")
+{
+    fixture<V, Er> f;
+    using Expected = fixture<V, Er>::Expected;
+
+    SECTION("copy")
+    {
+        Expected v = f.value;
+        Expected e = f.error;
+        CHECK(V::stats() == copies(1));
+        CHECK(Er::stats() == copies(1));
+    }
+    SECTION("move")
+    {
+        Expected v = std::move(f.value);
+        Expected e = std::move(f.error);
+        CHECK(V::stats() == moves(1));
+        CHECK(Er::stats() == moves(1));
+    }
+    SECTION("from value")
+    {
+        V        v {3};
+        Expected e1 = v;
+        Expected e2 = std::move(v);
+        CHECK(V::stats() == copies(1) + moves(1));
+    }
+    SECTION("from unexpected")
+    {
+        unexpected<Er> u {std::in_place, 3};
+        operation_counter::reset<Er>();
+
+        Expected e1 = u;
+        Expected e2 = std::move(u);
+        CHECK(Er::stats() == copies(1) + moves(1));
+    }
+    SECTION("in place")
+    {
+        Expected v {std::in_place, 3};
+        Expected e {unexpect, 4};
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == none());
+    }
+    SECTION("converting")
+    {
+        expected<V, int> other {std::in_place, 3};
+        operation_counter::reset<V>();
+
+        expected<V, long> e1 = other;
+        expected<V, long> e2 = std::move(other);
+        CHECK(V::stats() == copies(1) + moves(1));
+    }
+}
+
+TEST_CASE("copy assignment operation counts", "[operation-counts, assignment]")
+{
+    SECTION("value = value")
+    {
+        fixture<V, Er> f;
+        auto           target = f.value;
+        operation_counter::reset<V, Er>();
+
+        target = f.value;
+        CHECK(V::stats() == copies(0, 1));
+        CHECK(Er::stats() == none());
+    }
+    SECTION("error = error")
+    {
+        fixture<V, Er> f;
+        auto           target = f.error;
+        operation_counter::reset<V, Er>();
+
+        target = f.error;
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == copies(0, 1));
+    }
+    SECTION("value = error, direct construction")
+    {
+        fixture<V, Er> f;
+        auto           target = f.value;
+        operation_counter::reset<V, Er>();
+
+        target = f.error;
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == copies(1));
+    }
+    SECTION("error = value, direct construction")
+    {
+        fixture<V, Er> f;
+        auto           target = f.error;
+        operation_counter::reset<V, Er>();
+
+        target = f.value;
+        CHECK(V::stats() == copies(1));
+        CHECK(Er::stats() == none());
+    }
+    SECTION("error = value, construct then move")
+    {
+        // T's copy may throw, so the copy is made into a temporary first
+        // and then moved into place: one move more than direct construction.
+        fixture<VThrowingCopy, Er> f;
+        auto                       target = f.error;
+        operation_counter::reset<VThrowingCopy, Er>();
+
+        target = f.value;
+        CHECK(VThrowingCopy::stats() == copies(1) + moves(1));
+        CHECK(Er::stats() == none());
+    }
+    SECTION("error = value, backup and guard")
+    {
+        // Neither T's copy nor T's move is nothrow, so E is backed up
+        // in a temporary to be restored if the copy throws.
+        fixture<VThrowing, Er> f;
+        auto                   target = f.error;
+        operation_counter::reset<VThrowing, Er>();
+
+        target = f.value;
+        CHECK(VThrowing::stats() == copies(1));
+        CHECK(Er::stats() == moves(1));
+    }
+}
+
+TEST_CASE("move assignment operation counts", "[operation-counts, assignment]")
+{
+    SECTION("value = value")
+    {
+        fixture<V, Er> f;
+        auto           target = f.value;
+        operation_counter::reset<V, Er>();
+
+        target = std::move(f.value);
+        CHECK(V::stats() == moves(0, 1));
+        CHECK(Er::stats() == none());
+    }
+    SECTION("error = error")
+    {
+        fixture<V, Er> f;
+        auto           target = f.error;
+        operation_counter::reset<V, Er>();
+
+        target = std::move(f.error);
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == moves(0, 1));
+    }
+    SECTION("value = error")
+    {
+        fixture<V, Er> f;
+        auto           target = f.value;
+        operation_counter::reset<V, Er>();
+
+        target = std::move(f.error);
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == moves(1));
+    }
+    SECTION("error = value")
+    {
+        fixture<V, Er> f;
+        auto           target = f.error;
+        operation_counter::reset<V, Er>();
+
+        target = std::move(f.value);
+        CHECK(V::stats() == moves(1));
+        CHECK(Er::stats() == none());
+    }
+    SECTION("error = value, backup and guard")
+    {
+        fixture<VThrowing, Er> f;
+        auto                   target = f.error;
+        operation_counter::reset<VThrowing, Er>();
+
+        target = std::move(f.value);
+        CHECK(VThrowing::stats() == moves(1));
+        CHECK(Er::stats() == moves(1));
+    }
+    SECTION("value = error, backup and guard")
+    {
+        fixture<V, ErThrowing> f;
+        auto                   target = f.value;
+        operation_counter::reset<V, ErThrowing>();
+
+        target = std::move(f.error);
+        CHECK(V::stats() == moves(1));
+        CHECK(ErThrowing::stats() == moves(1));
+    }
+}
+
+TEST_CASE("value and unexpected assignment operation counts", "[operation-counts, assignment]")
+{
+    SECTION("value holder = T&&")
+    {
+        fixture<V, Er> f;
+        V              v {3};
+        f.value = std::move(v);
+        CHECK(V::stats() == moves(0, 1));
+    }
+    SECTION("error holder = T&&")
+    {
+        fixture<V, Er> f;
+        V              v {3};
+        f.error = std::move(v);
+        CHECK(V::stats() == moves(1));
+        CHECK(Er::stats() == none());
+    }
+    SECTION("error holder = unexpected&&")
+    {
+        fixture<V, Er> f;
+        unexpected<Er> u {std::in_place, 3};
+        operation_counter::reset<Er>();
+
+        f.error = std::move(u);
+        CHECK(Er::stats() == moves(0, 1));
+    }
+    SECTION("value holder = unexpected&&")
+    {
+        fixture<V, Er> f;
+        unexpected<Er> u {std::in_place, 3};
+        operation_counter::reset<Er>();
+
+        f.value = std::move(u);
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == moves(1));
+    }
+}
+
+TEST_CASE("emplace operation counts", "[operation-counts, emplace]")
+{
+    SECTION("from arguments")
+    {
+        fixture<V, Er> f;
+        f.value.emplace(3);
+        f.error.emplace(4);
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == none());
+    }
+    SECTION("from T&&")
+    {
+        fixture<V, Er> f;
+        V              v {3};
+        f.error.emplace(std::move(v));
+        CHECK(V::stats() == moves(1));
+        CHECK(Er::stats() == none());
+    }
+    SECTION("void-T")
+    {
+        expected<void, Er> e {unexpect, 1};
+        operation_counter::reset<Er>();
+
+        e.emplace();
+        CHECK(Er::stats() == none());
+    }
+}
+
+TEST_CASE("swap operation counts", "[operation-counts, swap]")
+{
+    SECTION("value <-> value")
+    {
+        fixture<V, Er> f;
+        auto           other = f.value;
+        operation_counter::reset<V, Er>();
+
+        f.value.swap(other);
+        CHECK(V::stats() == moves(1, 2));
+        CHECK(Er::stats() == none());
+    }
+    SECTION("error <-> error")
+    {
+        fixture<V, Er> f;
+        auto           other = f.error;
+        operation_counter::reset<V, Er>();
+
+        f.error.swap(other);
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == moves(1, 2));
+    }
+    SECTION("value <-> error, E nothrow movable")
+    {
+        // E goes through a temporary, T is moved directly.
+        fixture<V, Er> f;
+        f.value.swap(f.error);
+        CHECK(V::stats() == moves(1));
+        CHECK(Er::stats() == moves(2));
+        CHECK(f.value.error().value == 2);
+        CHECK(f.error.value().value == 1);
+    }
+    SECTION("error <-> value, E nothrow movable")
+    {
+        fixture<V, Er> f;
+        f.error.swap(f.value);
+        CHECK(V::stats() == moves(1));
+        CHECK(Er::stats() == moves(2));
+    }
+    SECTION("value <-> error, T nothrow movable, E throwing")
+    {
+        // T goes through a temporary, E is moved directly.
+        fixture<V, ErThrowing> f;
+        f.value.swap(f.error);
+        CHECK(V::stats() == moves(2));
+        CHECK(ErThrowing::stats() == moves(1));
+    }
+    SECTION("value <-> error, T throwing, E nothrow movable")
+    {
+        fixture<VThrowing, Er> f;
+        f.value.swap(f.error);
+        CHECK(VThrowing::stats() == moves(1));
+        CHECK(Er::stats() == moves(2));
+    }
+    SECTION("void-T value <-> error")
+    {
+        expected<void, Er> v;
+        expected<void, Er> e {unexpect, 1};
+        operation_counter::reset<Er>();
+
+        v.swap(e);
+        CHECK(Er::stats() == moves(1));
+    }
+}
+
+TEST_CASE("and_then() operation counts", "[operation-counts, monadic]")
+{
+    auto const f = [](auto&& v) { return expected<int, Er>(v.value); };
+
+    SECTION("value")
+    {
+        fixture<V, Er> fx;
+        (void) fx.value.and_then(f);
+        (void) std::move(fx.value).and_then(f);
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == none());
+    }
+    SECTION("error, lvalue")
+    {
+        fixture<V, Er> fx;
+        (void) fx.error.and_then(f);
+        CHECK(Er::stats() == copies(1));
+    }
+    SECTION("error, rvalue")
+    {
+        fixture<V, Er> fx;
+        (void) std::move(fx.error).and_then(f);
+        CHECK(Er::stats() == moves(1));
+    }
+}
+
+TEST_CASE("transform() operation counts", "[operation-counts, monadic]")
+{
+    SECTION("value, result constructed in place")
+    {
+        fixture<V, Er> fx;
+        auto           r1 = fx.value.transform([](const V& v) { return V {v.value + 1}; });
+        auto           r2 = std::move(fx.value).transform([](V&& v) { return V {v.value + 1}; });
+        CHECK(V::stats() == none());
+        CHECK(r1.value().value == 2);
+        CHECK(r2.value().value == 2);
+    }
+    SECTION("error, lvalue")
+    {
+        fixture<V, Er> fx;
+        (void) fx.error.transform([](const V& v) { return v.value; });
+        CHECK(Er::stats() == copies(1));
+    }
+    SECTION("error, rvalue")
+    {
+        fixture<V, Er> fx;
+        (void) std::move(fx.error).transform([](V&& v) { return v.value; });
+        CHECK(Er::stats() == moves(1));
+    }
+}
+
+TEST_CASE("transform_error() operation counts", "[operation-counts, monadic]")
+{
+    SECTION("error, result constructed in place")
+    {
+        fixture<V, Er> fx;
+        (void) fx.error.transform_error([](const Er& e) { return Er {e.value + 1}; });
+        (void) std::move(fx.error).transform_error([](Er&& e) { return Er {e.value + 1}; });
+        CHECK(Er::stats() == none());
+    }
+    SECTION("value, lvalue")
+    {
+        fixture<V, Er> fx;
+        (void) fx.value.transform_error([](const Er& e) { return e.value; });
+        CHECK(V::stats() == copies(1));
+    }
+    SECTION("value, rvalue")
+    {
+        fixture<V, Er> fx;
+        (void) std::move(fx.value).transform_error([](Er&& e) { return e.value; });
+        CHECK(V::stats() == moves(1));
+    }
+    SECTION("void-T error")
+    {
+        expected<void, Er> e {unexpect, 1};
+        operation_counter::reset<Er>();
+
+        (void) e.transform_error([](const Er& err) { return Er {err.value + 1}; });
+        CHECK(Er::stats() == none());
+    }
+}
+
+TEST_CASE("or_else() operation counts", "[operation-counts, monadic]")
+{
+    auto const f = [](auto&& e) { return expected<V, int>(unexpect, e.value); };
+
+    SECTION("error")
+    {
+        fixture<V, Er> fx;
+        (void) fx.error.or_else(f);
+        (void) std::move(fx.error).or_else(f);
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == none());
+    }
+    SECTION("value, lvalue")
+    {
+        fixture<V, Er> fx;
+        (void) fx.value.or_else(f);
+        CHECK(V::stats() == copies(1));
+    }
+    SECTION("value, rvalue")
+    {
+        fixture<V, Er> fx;
+        (void) std::move(fx.value).or_else(f);
+        CHECK(V::stats() == moves(1));
+    }
+}
+
+TEST_CASE("value_or() and error_or() operation counts", "[operation-counts, value_or]")
+{
+    fixture<V, Er> fx;
+
+    (void) fx.value.value_or(V {0});
+    CHECK(V::stats() == copies(1));
+
+    V::reset();
+    (void) std::move(fx.value).value_or(V {0});
+    CHECK(V::stats() == moves(1));
+
+    (void) fx.error.error_or(Er {0});
+    CHECK(Er::stats() == copies(1));
+
+    Er::reset();
+    (void) std::move(fx.error).error_or(Er {0});
+    CHECK(Er::stats() == moves(1));
+}
+
+TEST_CASE("in-place monadic operation counts", "[operation-counts, monadic, inplace]")
+{
+    SECTION("transform_inplace()")
+    {
+        fixture<V, Er> fx;
+        auto           r = std::move(fx.value).transform_inplace([](V& v) { ++v.value; }).transform_inplace([](V& v) { ++v.value; });
+        CHECK(r->value == 3);
+        CHECK(V::stats() == moves(1)); // into r
+    }
+    SECTION("and_then_inplace(), success")
+    {
+        fixture<V, Er> fx;
+        fx.value.and_then_inplace([](V& v) -> expected<void, Er> {
+            ++v.value;
+            return {};
+        });
+        CHECK(fx.value->value == 2);
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == none());
+    }
+    SECTION("and_then_inplace(), failure")
+    {
+        fixture<V, Er> fx;
+        fx.value.and_then_inplace([](V&) -> expected<void, Er> { return expected<void, Er>(unexpect, 3); });
+        CHECK(fx.value.error().value == 3);
+        CHECK(V::stats() == none());
+        CHECK(Er::stats() == moves(1));
+    }
+    SECTION("transform_error_inplace()")
+    {
+        fixture<V, Er> fx;
+        fx.error.transform_error_inplace([](Er& e) { ++e.value; });
+        CHECK(fx.error.error().value == 3);
+        CHECK(Er::stats() == none());
+    }
+}
+
+TEST_CASE("value_or_else() and error_or_else() operation counts", "[operation-counts, value_or]")
+{
+    fixture<V, Er> fx;
+
+    (void) fx.value.value_or_else([] { return V {0}; });
+    CHECK(V::stats() == copies(1));
+
+    V::reset();
+    (void) std::move(fx.value).value_or_else([] { return V {0}; });
+    CHECK(V::stats() == moves(1));
+
+    // the default is constructed in place and the error is not touched
+    V::reset();
+    (void) std::move(fx.error).value_or_else([](Er&& e) { return V {e.value}; });
+    CHECK(V::stats() == none());
+    CHECK(Er::stats() == none());
+
+    (void) fx.error.error_or_else([] { return Er {0}; });
+    CHECK(Er::stats() == copies(1));
+
+    Er::reset();
+    (void) std::move(fx.error).error_or_else([] { return Er {0}; });
+    CHECK(Er::stats() == moves(1));
+
+    Er::reset();
+    (void) fx.value.error_or_else([] { return Er {0}; });
+    CHECK(Er::stats() == none());
+}
+
+TEST_CASE("from_invoke() and from_error_invoke() operation counts", "[operation-counts, constructors]")
+{
+    using Expected = expected<V, Er>;
+
+    auto const make_value = [](int v) { return V {v}; };
+    auto const make_error = [](int v) { return Er {v}; };
+
+    operation_counter::reset<V, Er>();
+
+    SECTION("value")
+    {
+        Expected const e = Expected::from_invoke(make_value, 1);
+        REQUIRE(e.has_value());
+        CHECK(e->value == 1);
+        CHECK(V::stats() == none());
+    }
+    SECTION("value, converting constructor of expected")
+    {
+        Expected const e = make_value(1);
+        CHECK(V::stats() == moves(1));
+    }
+    SECTION("error")
+    {
+        Expected const e = Expected::from_error_invoke(make_error, 2);
+        REQUIRE_FALSE(e.has_value());
+        CHECK(e.error().value == 2);
+        CHECK(Er::stats() == none());
+    }
+    SECTION("void-T")
+    {
+        using VoidExpected = expected<void, Er>;
+
+        int calls = 0;
+        CHECK(VoidExpected::from_invoke([&] { ++calls; }).has_value());
+        CHECK(calls == 1);
+
+        VoidExpected const e = VoidExpected::from_error_invoke(make_error, 3);
+        CHECK(e.error().value == 3);
+        CHECK(Er::stats() == none());
+    }
+}
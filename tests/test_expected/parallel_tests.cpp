@@ -0,0 +1,153 @@
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/parallel.hpp>
+
+using namespace zeus;
+
+namespace
+{
+
+std::vector<int> iota(int n)
+{
+    std::vector<int> v(static_cast<std::size_t>(n));
+    std::iota(v.begin(), v.end(), 0);
+    return v;
+}
+
+expected<int, std::string> checked_square(int x)
+{
+    if (x % 1000 == 999)
+        return unexpected("bad " + std::to_string(x));
+    return x * x;
+}
+
+} // namespace
+
+TEST_CASE("parallel_transform() keeps the order of the results", "[parallel]")
+{
+    std::vector<int> const in = iota(998);
+
+    for (std::size_t threads : {1, 2, 4, 7})
+    {
+        auto const r = parallel_transform(parallel_policy {threads, 16}, in, checked_square);
+        REQUIRE(r.has_value());
+        REQUIRE(r->size() == in.size());
+        for (std::size_t i = 0; i < in.size(); ++i)
+        {
+            CHECK((*r)[i] == in[i] * in[i]);
+        }
+    }
+
+    CHECK(parallel_transform(std::vector<int> {}, checked_square) == std::vector<int> {});
+}
+
+TEST_CASE("parallel_transform() returns the error of the smallest index", "[parallel]")
+{
+    std::vector<int> const in = iota(100'000);
+
+    for (int run = 0; run < 20; ++run)
+    {
+        for (std::size_t threads : {1, 3, 8})
+        {
+            CHECK(parallel_transform(parallel_policy {threads, 64}, in, checked_square) == unexpected<std::string>("bad 999"));
+        }
+    }
+}
+
+TEST_CASE("parallel_transform() abandons the elements past an error", "[parallel]")
+{
+    std::vector<int> const in = iota(1'000'000);
+    std::atomic<int>       calls {0};
+
+    auto const r = parallel_transform(parallel_policy {4, 128}, in, [&](int x) -> expected<int, int> {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        if (x == 10)
+            return unexpected(x);
+        return x;
+    });
+    CHECK(r == unexpected(10));
+    CHECK(calls.load() < 10'000);
+}
+
+TEST_CASE("parallel_transform() with move-only and non default constructible values", "[parallel]")
+{
+    struct boxed
+    {
+        explicit boxed(int v)
+            : value(std::make_unique<int>(v))
+        {
+        }
+        std::unique_ptr<int> value;
+    };
+
+    std::vector<int> const in = iota(50);
+
+    auto const r = parallel_transform(parallel_policy {3, 4}, in, [](int x) { return expected<boxed, int>(std::in_place, x); });
+    REQUIRE(r.has_value());
+    CHECK(*(*r)[49].value == 49);
+
+    auto const flags = parallel_transform(parallel_policy {3, 1}, in, [](int x) { return expected<bool, int>(x % 2 == 0); });
+    REQUIRE(flags.has_value());
+    CHECK(flags->at(48));
+    CHECK_FALSE(flags->at(49));
+}
+
+TEST_CASE("parallel_transform() moves from rvalue ranges", "[parallel]")
+{
+    std::vector<std::unique_ptr<int>> in;
+    for (int i = 0; i < 10; ++i)
+    {
+        in.push_back(std::make_unique<int>(i));
+    }
+
+    auto const r = parallel_transform(parallel_policy {2, 2}, std::move(in), [](std::unique_ptr<int> p) { return expected<int, int>(*p); });
+    CHECK(r == std::vector<int> {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    CHECK(in[0] == nullptr);
+}
+
+TEST_CASE("parallel_transform() of void results", "[parallel, void-T]")
+{
+    std::vector<int> const in = iota(1000);
+    std::atomic<long>      sum {0};
+
+    auto const ok = parallel_transform(parallel_policy {4, 10}, in, [&](int x) -> expected<void, int> {
+        sum.fetch_add(x);
+        return {};
+    });
+    static_assert(std::is_same_v<decltype(ok), const expected<void, int>>);
+    CHECK(ok.has_value());
+    CHECK(sum.load() == 999 * 1000 / 2);
+
+    auto const bad = parallel_transform(parallel_policy {4, 10}, in, [](int x) -> expected<void, int> {
+        if (x >= 500)
+            return unexpected(x);
+        return {};
+    });
+    CHECK(bad == unexpected(500));
+}
+
+TEST_CASE("parallel_transform() rethrows exceptions", "[parallel]")
+{
+    std::vector<int> const in = iota(1000);
+
+    CHECK_THROWS_AS(
+        parallel_transform(
+            parallel_policy {4, 10},
+            in,
+            [](int x) -> expected<int, int> {
+                if (x == 300)
+                    throw std::runtime_error("boom");
+                return x;
+            }
+        ),
+        std::runtime_error
+    );
+}
@@ -0,0 +1,122 @@
+#include <forward_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/partition.hpp>
+
+#include "operation_counter.hpp"
+
+using namespace zeus;
+
+namespace
+{
+
+std::vector<expected<int, std::string>> mixed(int n)
+{
+    std::vector<expected<int, std::string>> v;
+    for (int i = 0; i < n; ++i)
+    {
+        if (i % 7 == 3)
+            v.emplace_back(unexpect, "e" + std::to_string(i));
+        else
+            v.emplace_back(i);
+    }
+    return v;
+}
+
+} // namespace
+
+TEST_CASE("partition_results() splits values and errors", "[partition]")
+{
+    std::vector<expected<int, std::string>> const in {1, unexpected<std::string>("a"), 3, 4, unexpected<std::string>("b")};
+
+    auto const r = partition_results(in);
+    CHECK(r.values == std::vector<int> {1, 3, 4});
+    CHECK(r.error_indices == std::vector<std::size_t> {1, 4});
+    CHECK(r.errors == std::vector<std::string> {"a", "b"});
+    CHECK(r.values.capacity() >= in.size());
+
+    std::forward_list<expected<int, int>> const unsized {unexpected(1), 2};
+    auto const                                  u = partition_results(unsized);
+    CHECK(u.values == std::vector<int> {2});
+    CHECK(u.error_indices == std::vector<std::size_t> {0});
+}
+
+TEST_CASE("partition_results() moves from rvalue ranges", "[partition]")
+{
+    using V = operation_counter::counted<struct partition_value_tag>;
+    using E = operation_counter::counted<struct partition_error_tag>;
+
+    std::vector<expected<V, E>> in(4);
+    in[2] = unexpected<E>(std::in_place);
+
+    operation_counter::reset<V, E>();
+    auto r = partition_results(std::move(in));
+    CHECK(r.values.size() == 3);
+    CHECK(r.errors.size() == 1);
+    CHECK(V::stats().copy_constructions == 0);
+    CHECK(E::stats().copy_constructions == 0);
+
+    std::vector<expected<V, E>> const lvalue(2);
+    operation_counter::reset<V, E>();
+    (void) partition_results(lvalue);
+    CHECK(V::stats().copy_constructions == 2);
+}
+
+TEST_CASE("partition_results() of void expecteds", "[partition, void-T]")
+{
+    std::vector<expected<void, int>> const in {{}, unexpected(1), {}, unexpected(2)};
+
+    auto const r = partition_results(in);
+    CHECK(r.value_count == 2);
+    CHECK(r.error_indices == std::vector<std::size_t> {1, 3});
+    CHECK(r.errors == std::vector<int> {1, 2});
+
+    auto const p = partition_results(parallel_policy {2, 1}, in);
+    CHECK(p.value_count == 2);
+    CHECK(p.error_indices == std::vector<std::size_t> {1, 3});
+}
+
+TEST_CASE("parallel partition_results() matches the single pass", "[partition, parallel]")
+{
+    std::vector<expected<int, std::string>> const in = mixed(10'000);
+
+    auto const expected_result = partition_results(in);
+    for (std::size_t threads : {1, 2, 5})
+    {
+        for (std::size_t chunk : {1, 64, 20'000})
+        {
+            auto const r = partition_results(parallel_policy {threads, chunk}, in);
+            CHECK(r.values == expected_result.values);
+            CHECK(r.error_indices == expected_result.error_indices);
+            CHECK(r.errors == expected_result.errors);
+        }
+    }
+
+    auto const empty = partition_results(parallel_policy {4}, std::vector<expected<int, int>> {});
+    CHECK(empty.values.empty());
+    CHECK(empty.errors.empty());
+}
+
+TEST_CASE("parallel partition_results() moves from rvalue ranges", "[partition, parallel]")
+{
+    std::vector<expected<std::unique_ptr<int>, int>> in;
+    for (int i = 0; i < 100; ++i)
+    {
+        if (i % 10 == 0)
+            in.emplace_back(unexpect, i);
+        else
+            in.emplace_back(std::make_unique<int>(i));
+    }
+
+    auto const r = partition_results(parallel_policy {3, 8}, std::move(in));
+    REQUIRE(r.values.size() == 90);
+    CHECK(*r.values[0] == 1);
+    CHECK(*r.values[89] == 99);
+    CHECK(r.errors[9] == 90);
+    CHECK(in[1].value() == nullptr);
+}
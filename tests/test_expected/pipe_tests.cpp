@@ -0,0 +1,127 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/pipe.hpp>
+
+using namespace zeus;
+
+namespace
+{
+
+using Expected = expected<std::string, int>;
+
+expected<int, int> parse(const std::string& s)
+{
+    if (s.empty() || s.find_first_not_of("0123456789") != std::string::npos)
+        return unexpected(1);
+    return std::stoi(s);
+}
+
+double scale(int x)
+{
+    return x * 0.5;
+}
+
+int annotate(int e)
+{
+    return e + 100;
+}
+
+expected<double, int> fallback(int e)
+{
+    if (e == 101)
+        return -1.0;
+    return unexpected(e);
+}
+
+} // namespace
+
+TEST_CASE("pipe adaptors match the member chain", "[pipe]")
+{
+    for (Expected const& e : {Expected("42"), Expected("4x"), Expected(unexpect, 7)})
+    {
+        auto const member = e.and_then(parse).transform(scale).transform_error(annotate).or_else(fallback);
+
+        expected<double, int> const piped =
+            e | zeus::and_then(parse) | zeus::transform(scale) | zeus::transform_error(annotate) | zeus::or_else(fallback);
+        CHECK(piped == member);
+
+        auto const evaluated = (e | zeus::and_then(parse) | zeus::transform(scale)).eval();
+        CHECK(evaluated == e.and_then(parse).transform(scale));
+    }
+}
+
+TEST_CASE("pipe adaptors with value_or()", "[pipe]")
+{
+    Expected const good {"42"};
+    Expected const bad {"nope"};
+
+    CHECK((good | zeus::and_then(parse) | zeus::transform(scale) | zeus::value_or(0)) == 21.0);
+    CHECK((bad | zeus::and_then(parse) | zeus::transform(scale) | zeus::value_or(0)) == 0.0);
+    CHECK((expected<int, int>(3) | zeus::value_or(0)) == 3);
+    CHECK((expected<int, int>(unexpect, 3) | zeus::value_or(0)) == 0);
+}
+
+TEST_CASE("composed pipe adaptors are reusable", "[pipe]")
+{
+    auto const steps = zeus::and_then(parse) | zeus::transform(scale) | zeus::transform_error(annotate);
+    auto const total = steps | zeus::value_or(0.0);
+
+    static_assert(std::is_same_v<decltype(steps(std::declval<Expected>())), expected<double, int>>);
+
+    std::vector<Expected> const inputs {"2", "x", "10", Expected(unexpect, 5)};
+    std::vector<double>         values;
+    for (auto const& in : inputs)
+    {
+        CHECK(steps(in) == in.and_then(parse).transform(scale).transform_error(annotate));
+        CHECK((in | steps).eval() == steps(in));
+        values.push_back(in | total);
+    }
+    CHECK(values == std::vector<double> {1.0, 0.0, 5.0, 0.0});
+}
+
+TEST_CASE("pipe adaptors on expected<void, E>", "[pipe, void-T]")
+{
+    using VoidExpected = expected<void, int>;
+
+    auto const steps = zeus::transform([] { return 5; }) | zeus::transform_error([](int e) { return e * 2; });
+
+    CHECK(steps(VoidExpected {}) == 5);
+    CHECK(steps(VoidExpected {unexpect, 4}) == unexpected(8));
+    CHECK((VoidExpected {unexpect, 4} | zeus::or_else([](int) { return VoidExpected {}; })).eval().has_value());
+}
+
+TEST_CASE("pipe adaptors forward rvalue sources", "[pipe]")
+{
+    using Ptr = std::unique_ptr<int>;
+
+    auto const take = [](Ptr&& p) { return std::move(p); };
+
+    expected<Ptr, int> e {std::make_unique<int>(42)};
+    expected<Ptr, int> r = std::move(e) | zeus::transform(take);
+    CHECK(**r == 42);
+    CHECK(*e == nullptr);
+}
+
+TEST_CASE("a pipe on a temporary may be stored and evaluated later", "[pipe]")
+{
+    auto const make = [] { return Expected("a string long enough to live on the heap: 12"); };
+    auto const size = [](const std::string& s) { return s.size(); };
+
+    // the chain owns a moved-from copy of the temporary
+    auto chain = make() | zeus::transform(size);
+    auto more  = make() | zeus::transform(size) | zeus::transform([](std::size_t n) { return n * 2; });
+
+    expected<std::size_t, int> const r = std::move(chain);
+    CHECK(r == make()->size());
+    CHECK(std::move(more).eval() == 2 * make()->size());
+
+    auto const n = make() | zeus::transform(size) | zeus::value_or(std::size_t {0});
+    CHECK(n == make()->size());
+    CHECK((Expected(unexpect, 1) | zeus::transform(size) | zeus::value_or(std::size_t {7})) == 7);
+}
@@ -0,0 +1,164 @@
+#include <forward_list>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/reduce.hpp>
+
+using namespace zeus;
+
+namespace
+{
+
+std::vector<expected<int, std::string>> numbers(int n)
+{
+    std::vector<expected<int, std::string>> v;
+    for (int i = 0; i < n; ++i)
+    {
+        v.emplace_back(i);
+    }
+    return v;
+}
+
+expected<int, std::string> bounded_add(int a, int b)
+{
+    if (a + b > 1'000)
+        return unexpected<std::string>("overflow");
+    return a + b;
+}
+
+} // namespace
+
+TEST_CASE("fold() accumulates the values of a range of expected", "[reduce]")
+{
+    CHECK(fold(numbers(10), 0, std::plus<>()) == 45);
+    CHECK(fold(std::vector<expected<int, std::string>> {}, 7, std::plus<>()) == 7);
+
+    std::forward_list<expected<std::string, int>> const words {std::string("a"), std::string("b"), std::string("c")};
+    CHECK(fold(words, std::string(">"), std::plus<>()) == ">abc");
+}
+
+TEST_CASE("fold() stops at the first error", "[reduce]")
+{
+    auto v = numbers(10);
+    v[4]   = unexpected<std::string>("four");
+    v[7]   = unexpected<std::string>("seven");
+
+    int  calls = 0;
+    auto count = [&calls](int acc, int x) {
+        ++calls;
+        return acc + x;
+    };
+    CHECK(fold(v, 0, count) == unexpected<std::string>("four"));
+    CHECK(calls == 4);
+
+    // the function may fail too, with the error type of the range
+    CHECK(fold(numbers(100), 0, bounded_add) == unexpected<std::string>("overflow"));
+    CHECK(fold(numbers(10), 0, bounded_add) == 45);
+}
+
+TEST_CASE("fold() over a plain range with a fallible function", "[reduce]")
+{
+    std::vector<int> const v {1, 2, 3};
+
+    auto const r = fold(v, 0, [](int acc, int x) -> expected<int, std::string> {
+        if (x == 3)
+            return unexpected<std::string>("three");
+        return acc + x;
+    });
+    CHECK(r == unexpected<std::string>("three"));
+    CHECK(fold(v, 0, bounded_add) == 6);
+}
+
+TEST_CASE("fold() moves the values out of rvalue ranges", "[reduce]")
+{
+    std::vector<expected<std::unique_ptr<int>, int>> v;
+    v.emplace_back(std::make_unique<int>(1));
+    v.emplace_back(std::make_unique<int>(2));
+
+    auto const r = fold(std::move(v), std::vector<std::unique_ptr<int>> {}, [](auto acc, std::unique_ptr<int> p) {
+        acc.push_back(std::move(p));
+        return acc;
+    });
+    REQUIRE(r.has_value());
+    CHECK(*(*r)[1] == 2);
+}
+
+TEST_CASE("reduce() matches fold()", "[reduce, parallel]")
+{
+    auto const v   = numbers(10'000);
+    auto const sum = fold(v, 100, std::plus<>());
+    REQUIRE(sum == 100 + 9'999 * 10'000 / 2);
+
+    for (std::size_t threads : {1, 2, 5})
+    {
+        for (std::size_t chunk : {1, 3, 64, 20'000})
+        {
+            CHECK(reduce(parallel_policy {threads, chunk}, v, 100, std::plus<>()) == sum);
+        }
+    }
+    CHECK(reduce(v, 0, std::plus<>()) == 9'999 * 10'000 / 2);
+    CHECK(reduce(parallel_policy {4}, std::vector<expected<int, int>> {}, 3, std::plus<>()) == 3);
+}
+
+TEST_CASE("reduce() keeps the order of the operands", "[reduce, parallel]")
+{
+    std::vector<expected<std::string, int>> letters;
+    std::string                             all;
+    for (int i = 0; i < 500; ++i)
+    {
+        letters.emplace_back(std::string(1, static_cast<char>('a' + i % 26)));
+        all += *letters.back();
+    }
+
+    for (std::size_t threads : {1, 3, 8})
+    {
+        for (std::size_t chunk : {1, 7, 100})
+        {
+            CHECK(reduce(parallel_policy {threads, chunk}, letters, std::string(">"), std::plus<>()) == ">" + all);
+        }
+    }
+}
+
+TEST_CASE("reduce() reports the error of the smallest index", "[reduce, parallel]")
+{
+    auto v    = numbers(100'000);
+    v[71'234] = unexpected<std::string>("late");
+    v[3'001]  = unexpected<std::string>("early");
+    v[99'999] = unexpected<std::string>("last");
+
+    for (int run = 0; run < 10; ++run)
+    {
+        for (std::size_t threads : {1, 3, 8})
+        {
+            for (std::size_t chunk : {1, 64, 4'096})
+            {
+                CHECK(reduce(parallel_policy {threads, chunk}, v, 0LL, std::plus<>()) == unexpected<std::string>("early"));
+            }
+        }
+    }
+
+    std::vector<int> const ones(5'000, 1);
+    for (std::size_t chunk : {1, 100, 5'000})
+    {
+        CHECK(reduce(parallel_policy {4, chunk}, ones, 0, bounded_add) == unexpected<std::string>("overflow"));
+    }
+    CHECK(reduce(parallel_policy {4, 10}, std::vector<int>(999, 1), 0, bounded_add) == 999);
+}
+
+TEST_CASE("reduce() rethrows the exceptions of op", "[reduce, parallel]")
+{
+    std::vector<int> const v(1'000, 1);
+
+    auto const throwing = [](int acc, int x) -> expected<int, int> {
+        if (acc > 500)
+            throw std::runtime_error("too much");
+        return acc + x;
+    };
+    CHECK_THROWS_AS(reduce(parallel_policy {4, 1'000}, v, 0, throwing), std::runtime_error);
+}
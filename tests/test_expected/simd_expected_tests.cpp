@@ -0,0 +1,142 @@
+#include <array>
+#include <cstdint>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/simd_expected.hpp>
+
+using namespace zeus;
+
+namespace
+{
+
+enum class lane_error
+{
+    none,
+    negative,
+    too_large,
+};
+
+expected<int, lane_error> checked_half(int x)
+{
+    if (x < 0)
+        return unexpected(lane_error::negative);
+    return x / 2;
+}
+
+simd_expected<int, 8, lane_error> iota8()
+{
+    return simd_expected<int, 8, lane_error>(std::array<int, 8> {0, 1, 2, 3, 4, 5, 6, 7});
+}
+
+} // namespace
+
+TEST_CASE("simd_expected holds values, a mask and errors", "[simd_expected]")
+{
+    simd_expected<int, 8, lane_error> v = iota8();
+    CHECK(v.all_ok());
+    CHECK(!v.any_error());
+    CHECK(v.mask() == 0xFF);
+
+    v.set_error(3, lane_error::too_large);
+    CHECK(v.any_error());
+    CHECK(v.mask() == 0xF7);
+    CHECK(!v.has_value(3));
+    CHECK(v[3] == unexpected(lane_error::too_large));
+    CHECK(v[4] == 4);
+
+    v.set_value(3, 30);
+    CHECK(v.all_ok());
+    CHECK(v[3] == 30);
+
+    CHECK(simd_expected<float, 64, int>::full_mask == ~std::uint64_t {0});
+    CHECK(simd_expected<float, 64, int>().all_ok());
+    CHECK(simd_expected<float, 1, int>::full_mask == 1);
+}
+
+TEST_CASE("simd_expected converts from and to scalar expecteds", "[simd_expected]")
+{
+    std::array<expected<int, lane_error>, 4> const lanes {1, unexpected(lane_error::negative), 3, unexpected(lane_error::too_large)};
+
+    simd_expected<int, 4, lane_error> const v(lanes);
+    CHECK(v.mask() == 0b0101);
+    CHECK(v.values()[2] == 3);
+    CHECK(v.errors()[3] == lane_error::too_large);
+    CHECK(v.to_array() == lanes);
+}
+
+TEST_CASE("simd_expected from values and a mask", "[simd_expected]")
+{
+    std::array<int, 4> const values {10, 20, 30, 40};
+
+    simd_expected<int, 4, lane_error> const one_error(values, 0b1001 | 0xF0, lane_error::too_large);
+    CHECK(one_error.mask() == 0b1001);
+    CHECK(one_error[1] == unexpected(lane_error::too_large));
+    CHECK(one_error[3] == 40);
+
+    std::array<lane_error, 4> const errors {lane_error::none, lane_error::negative, lane_error::none, lane_error::too_large};
+    simd_expected<int, 4, lane_error> const per_lane(values, 0b0101, errors);
+    CHECK(per_lane[1] == unexpected(lane_error::negative));
+    CHECK(per_lane[3] == unexpected(lane_error::too_large));
+    CHECK(per_lane[2] == 30);
+}
+
+TEST_CASE("simd_expected::transform() maps every lane and keeps the errors", "[simd_expected]")
+{
+    simd_expected<int, 8, lane_error> v = iota8();
+    v.set_error(5, lane_error::negative);
+
+    auto const doubled = v.transform([](int x) { return x * 2.5; });
+    STATIC_REQUIRE(std::is_same_v<decltype(doubled), const simd_expected<double, 8, lane_error>>);
+    CHECK(doubled.mask() == v.mask());
+    CHECK(doubled[7] == 17.5);
+    CHECK(doubled[5] == unexpected(lane_error::negative));
+}
+
+TEST_CASE("simd_expected::transform() never passes the value of a failed lane to f", "[simd_expected]")
+{
+    simd_expected<int, 8, lane_error> v = iota8();
+    v.set_error(0, lane_error::negative);
+    v.set_value(3, 0);
+    v.set_error(3, lane_error::too_large);
+
+    auto const reciprocal = [](int x) { return 100 / x; };
+    auto const scaled     = v.transform(reciprocal);
+    CHECK(scaled.mask() == 0b1111'0110);
+    CHECK(scaled[1] == 100);
+    CHECK(scaled[4] == 25);
+    CHECK(scaled[3] == unexpected(lane_error::too_large));
+
+    auto const neutral = v.transform(reciprocal, 1);
+    CHECK(neutral.mask() == scaled.mask());
+    CHECK(neutral[7] == 14);
+
+    auto const checked = v.and_then([](int x) { return expected<int, lane_error>(100 / x); }, 1);
+    CHECK(checked.mask() == scaled.mask());
+    CHECK(checked[2] == 50);
+    CHECK(checked[0] == unexpected(lane_error::negative));
+
+    simd_expected<int, 8, lane_error> none(std::array<int, 8> {}, 0, lane_error::negative);
+    CHECK(none.transform(reciprocal).mask() == 0);
+    CHECK(none.and_then(checked_half)[5] == unexpected(lane_error::negative));
+}
+
+TEST_CASE("simd_expected::and_then() merges the masks", "[simd_expected]")
+{
+    simd_expected<int, 8, lane_error> v = iota8();
+    v.set_value(2, -4);
+    v.set_value(6, -1);
+    v.set_error(7, lane_error::too_large);
+
+    auto halves = v.and_then(checked_half);
+    CHECK(halves.mask() == 0b0011'1011);
+    CHECK(halves[4] == 2);
+    CHECK(halves[2] == unexpected(lane_error::negative));
+    CHECK(halves[6] == unexpected(lane_error::negative));
+    CHECK(halves[7] == unexpected(lane_error::too_large));
+
+    auto const chained = halves.and_then(checked_half).transform([](int x) { return x + 1; });
+    CHECK(chained.mask() == halves.mask());
+    CHECK(chained[5] == 2);
+}
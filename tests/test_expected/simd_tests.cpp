@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/simd.hpp>
+
+using namespace zeus;
+
+namespace
+{
+
+// an error every `period` elements, starting at `first_error`
+template<class T, class E>
+std::vector<expected<T, E>> make_results(std::size_t n, std::size_t first_error, std::size_t period)
+{
+    std::vector<expected<T, E>> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i >= first_error && (i - first_error) % period == 0)
+            v.emplace_back(unexpect);
+        else
+            v.emplace_back();
+    }
+    return v;
+}
+
+template<class T, class E>
+void check_against_has_value(const std::vector<expected<T, E>>& v)
+{
+    std::size_t count = 0;
+    std::size_t first = v.size();
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        count += v[i].has_value() ? 1 : 0;
+        if (!v[i].has_value() && first == v.size())
+            first = i;
+    }
+
+    CHECK(simd::count_values(v) == count);
+    CHECK(simd::find_first_error(v) == first);
+
+    std::vector<std::uint64_t> mask((v.size() + 63) / 64, ~std::uint64_t {0});
+    simd::has_value_mask(v, mask.data());
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        CHECK(((mask[i / 64] >> (i % 64)) & 1) == (v[i].has_value() ? 1u : 0u));
+    }
+    if (v.size() % 64 != 0)
+    {
+        CHECK((mask.back() >> (v.size() % 64)) == 0);
+    }
+}
+
+template<class T, class E>
+void check_layout()
+{
+    for (std::size_t n : {0, 1, 7, 8, 9, 15, 16, 17, 63, 64, 65, 200})
+    {
+        for (std::size_t first : {0, 3, 8, 40, 1000})
+        {
+            check_against_has_value(make_results<T, E>(n, first, 5));
+            check_against_has_value(make_results<T, E>(n, first, 1000));
+        }
+    }
+}
+
+struct big
+{
+    char bytes[37];
+};
+
+template<class T, class E>
+void check_kernels()
+{
+    using Exp = expected<T, E>;
+
+    constexpr std::size_t stride = sizeof(Exp);
+    constexpr std::size_t after  = stride - expected_detail::has_value_offset_v<T, E>;
+
+    for (std::size_t n : {0, 1, 8, 9, 17, 100, 1000})
+    {
+        for (std::size_t first_error : {0, 5, 16, 517, 2000})
+        {
+            std::vector<Exp> const v     = make_results<T, E>(n, first_error, 3);
+            const unsigned char   *flags = expected_detail::first_flag(v.data());
+
+            std::size_t const count = expected_detail::simd_kernels::count_scalar(flags, n, stride);
+            std::size_t const first = expected_detail::simd_kernels::find_error_scalar(flags, n, stride);
+            CHECK(first == std::min(n, first_error));
+
+#if ZEUS_EXPECTED_SIMD
+            if constexpr (16 % stride == 0)
+            {
+                CHECK(expected_detail::simd_kernels::count_sse2(flags, n, stride, after) == count);
+                CHECK(expected_detail::simd_kernels::find_error_sse2(flags, n, stride, after) == first);
+            }
+            if (expected_detail::simd_kernels::use_avx2())
+            {
+                CHECK(expected_detail::simd_kernels::count_avx2(flags, n, stride, after) == count);
+                CHECK(expected_detail::simd_kernels::find_error_avx2(flags, n, stride, after) == first);
+            }
+#else
+            (void) after;
+            (void) count;
+#endif
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("simd scans agree with has_value()", "[simd]")
+{
+    SECTION("expected<int32_t, int32_t>")
+    {
+        check_layout<std::int32_t, std::int32_t>();
+    }
+    SECTION("expected<float, uint16_t>")
+    {
+        check_layout<float, std::uint16_t>();
+    }
+    SECTION("expected<char, char>")
+    {
+        check_layout<char, char>();
+    }
+    SECTION("expected<uint16_t, char>")
+    {
+        check_layout<std::uint16_t, char>();
+    }
+    SECTION("expected<double, int64_t>")
+    {
+        check_layout<double, std::int64_t>();
+    }
+    SECTION("expected<big, int>")
+    {
+        check_layout<big, int>();
+    }
+    SECTION("expected<std::string, int>")
+    {
+        check_layout<std::string, int>();
+    }
+    SECTION("expected<void, int>")
+    {
+        check_layout<void, int>();
+    }
+    SECTION("expected<void, char>")
+    {
+        check_layout<void, char>();
+    }
+}
+
+TEST_CASE("simd scans on arrays and pointers", "[simd]")
+{
+    std::array<expected<int, int>, 4> const arr {1, 2, unexpected(3), 4};
+
+    CHECK(simd::count_values(arr) == 3);
+    CHECK(simd::find_first_error(arr) == 2);
+    CHECK(simd::count_values(arr.data() + 3, 1) == 1);
+    CHECK(simd::find_first_error(arr.data(), 2) == 2);
+}
+
+TEST_CASE("each simd kernel agrees with the scalar loop", "[simd]")
+{
+    check_kernels<std::int32_t, std::int32_t>();
+    check_kernels<float, std::uint16_t>();
+    check_kernels<char, char>();
+    check_kernels<std::uint16_t, char>();
+    check_kernels<double, std::int64_t>();
+    check_kernels<big, int>();
+}
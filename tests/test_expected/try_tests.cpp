@@ -0,0 +1,138 @@
+#include <string>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/try.hpp>
+
+#include "operation_counter.hpp"
+
+using namespace zeus;
+
+namespace
+{
+
+expected<int, std::string> parse_digit(char c)
+{
+    if (c < '0' || c > '9')
+        return unexpected(std::string("not a digit: ") + c);
+    return c - '0';
+}
+
+expected<int, std::string> parse_two_digits(const char* s)
+{
+    ZEUS_EXPECTED_TRY(int const tens, parse_digit(s[0]));
+    ZEUS_EXPECTED_TRY(int const ones, parse_digit(s[1]));
+    return tens * 10 + ones;
+}
+
+expected<void, std::string> check_digit(char c)
+{
+    ZEUS_EXPECTED_TRY_VOID(parse_digit(c));
+    return {};
+}
+
+struct value_tag;
+struct error_tag;
+using V        = operation_counter::counted<value_tag>;
+using Er       = operation_counter::counted<error_tag>;
+using Expected = expected<V, Er>;
+
+Expected make(bool ok)
+{
+    if (ok)
+        return Expected(std::in_place, 1);
+    return Expected(unexpect, 2);
+}
+
+expected<int, Er> unwrap(bool ok, int& out)
+{
+    ZEUS_EXPECTED_TRY(V v, make(ok));
+    out = v.value;
+    return v.value;
+}
+
+expected<int, Er> unwrap_lvalue(const Expected& e)
+{
+    ZEUS_EXPECTED_TRY(const V& v, e);
+    return v.value;
+}
+
+#ifdef ZEUS_EXPECTED_HAS_TRY_VALUE
+expected<int, std::string> parse_two_digits_expr(const char* s)
+{
+    return ZEUS_EXPECTED_TRY_VALUE(parse_digit(s[0])) * 10 + ZEUS_EXPECTED_TRY_VALUE(parse_digit(s[1]));
+}
+
+expected<int, Er> unwrap_expr(bool ok)
+{
+    V v = ZEUS_EXPECTED_TRY_VALUE(make(ok));
+    return v.value;
+}
+#endif
+
+} // namespace
+
+TEST_CASE("ZEUS_EXPECTED_TRY binds the value or returns the error", "[try]")
+{
+    CHECK(parse_two_digits("42") == 42);
+    CHECK(parse_two_digits("x2") == unexpected<std::string>("not a digit: x"));
+    CHECK(parse_two_digits("4y") == unexpected<std::string>("not a digit: y"));
+
+    CHECK(check_digit('1').has_value());
+    CHECK(check_digit('z') == unexpected<std::string>("not a digit: z"));
+}
+
+TEST_CASE("ZEUS_EXPECTED_TRY moves T and E exactly once", "[try, operation-counts]")
+{
+    using operation_counter::moves;
+    using operation_counter::none;
+
+    int out = 0;
+
+    operation_counter::reset<V, Er>();
+    CHECK(unwrap(true, out) == 1);
+    CHECK(out == 1);
+    CHECK(V::stats() == moves(1));
+    CHECK(Er::stats() == none());
+
+    operation_counter::reset<V, Er>();
+    CHECK(unwrap(false, out).error().value == 2);
+    CHECK(V::stats() == none());
+    CHECK(Er::stats() == moves(1));
+}
+
+TEST_CASE("ZEUS_EXPECTED_TRY with an lvalue expression", "[try, operation-counts]")
+{
+    using operation_counter::copies;
+    using operation_counter::none;
+
+    Expected const value = make(true);
+    Expected const error = make(false);
+
+    operation_counter::reset<V, Er>();
+    CHECK(unwrap_lvalue(value) == 1);
+    CHECK(V::stats() == none());
+
+    CHECK(unwrap_lvalue(error).error().value == 2);
+    CHECK(Er::stats() == copies(1));
+}
+
+#ifdef ZEUS_EXPECTED_HAS_TRY_VALUE
+TEST_CASE("ZEUS_EXPECTED_TRY_VALUE", "[try, operation-counts]")
+{
+    using operation_counter::moves;
+    using operation_counter::none;
+
+    CHECK(parse_two_digits_expr("42") == 42);
+    CHECK(parse_two_digits_expr("4y") == unexpected<std::string>("not a digit: y"));
+
+    operation_counter::reset<V, Er>();
+    CHECK(unwrap_expr(true) == 1);
+    CHECK(V::stats() == moves(1));
+
+    operation_counter::reset<V, Er>();
+    CHECK(unwrap_expr(false).error().value == 2);
+    CHECK(Er::stats() == moves(1));
+}
+#endif
@@ -0,0 +1,106 @@
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/validate.hpp>
+
+#include "operation_counter.hpp"
+
+using namespace zeus;
+
+namespace
+{
+
+enum class field_error
+{
+    missing_name,
+    bad_age,
+    bad_email,
+};
+
+struct error_tag;
+using Er = operation_counter::counted<error_tag>;
+
+} // namespace
+
+TEST_CASE("error_list stores up to N errors and counts the rest", "[validate, error_list]")
+{
+    error_list<std::string, 2> list;
+    STATIC_REQUIRE(decltype(list)::capacity() == 2);
+    CHECK(list.empty());
+
+    CHECK(list.push_back("a string long enough to be allocated on the heap"));
+    CHECK(list.emplace_back(3, 'b'));
+    CHECK_FALSE(list.push_back("c"));
+    CHECK_FALSE(list.push_back("d"));
+
+    CHECK(list.size() == 2);
+    CHECK(list.overflow() == 2);
+    CHECK(list.total() == 4);
+    CHECK(list.front() == "a string long enough to be allocated on the heap");
+    CHECK(list.back() == "bbb");
+
+    auto copy = list;
+    CHECK(copy == list);
+
+    auto moved = std::move(copy);
+    CHECK(moved == list);
+
+    moved.clear();
+    CHECK(moved.empty());
+    CHECK(moved.overflow() == 0);
+    CHECK(moved != list);
+
+    moved = list;
+    CHECK(moved == list);
+}
+
+TEST_CASE("validate() combines values like zip()", "[validate]")
+{
+    expected<std::string, field_error> const name {"ada"};
+    expected<int, field_error> const         age {36};
+    expected<void, field_error> const        checked;
+
+    auto const r = zeus::validate(name, age, checked);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(r)>, expected<std::tuple<std::string, int>, error_list<field_error, 3>>>);
+    REQUIRE(r.has_value());
+    CHECK(*r == std::make_tuple(std::string("ada"), 36));
+}
+
+TEST_CASE("validate() accumulates all errors in order", "[validate]")
+{
+    expected<std::string, field_error> const name {unexpect, field_error::missing_name};
+    expected<int, field_error> const         age {36};
+    expected<std::string, field_error> const email {unexpect, field_error::bad_email};
+
+    auto const r = zeus::validate(name, age, email);
+    REQUIRE_FALSE(r.has_value());
+    REQUIRE(r.error().size() == 2);
+    CHECK(r.error()[0] == field_error::missing_name);
+    CHECK(r.error()[1] == field_error::bad_email);
+    CHECK(r.error().overflow() == 0);
+
+    auto const small = zeus::validate<1>(name, age, email);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(small)>::error_type, error_list<field_error, 1>>);
+    REQUIRE(small.error().size() == 1);
+    CHECK(small.error().front() == field_error::missing_name);
+    CHECK(small.error().overflow() == 1);
+}
+
+TEST_CASE("validate() moves errors out of rvalue arguments once", "[validate, operation-counts]")
+{
+    using operation_counter::copies;
+    using operation_counter::moves;
+
+    expected<int, Er> a {unexpect, 1};
+    expected<int, Er> b {unexpect, 2};
+
+    operation_counter::reset<Er>();
+    auto r = zeus::validate(std::move(a), b);
+    CHECK(r.error()[0].value == 1);
+    CHECK(r.error()[1].value == 2);
+    CHECK(Er::stats() == moves(1) + copies(1));
+}
@@ -0,0 +1,207 @@
+#include <zeus/expected/views.hpp>
+
+#if ZEUS_EXPECTED_HAS_RANGES
+
+    #include <algorithm>
+    #include <array>
+    #include <forward_list>
+    #include <list>
+    #include <memory>
+    #include <ranges>
+    #include <string>
+    #include <vector>
+
+    #include <catch2/catch_all.hpp>
+
+    #include <zeus/expected.hpp>
+
+    #include "operation_counter.hpp"
+
+using namespace zeus;
+
+namespace
+{
+
+std::vector<expected<int, std::string>> mixed()
+{
+    return {unexpected<std::string>("a"), 1, 2, unexpected<std::string>("b"), 3, unexpected<std::string>("c")};
+}
+
+template<class Range>
+auto to_vector(Range &&r)
+{
+    std::vector<std::ranges::range_value_t<Range>> out;
+    for (auto &&x : r)
+    {
+        out.push_back(x);
+    }
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("views::values yields references to the values", "[views]")
+{
+    auto v = mixed();
+
+    CHECK(to_vector(v | views::values) == std::vector<int> {1, 2, 3});
+
+    for (int &x : v | views::values)
+    {
+        x *= 10;
+    }
+    CHECK(*v[1] == 10);
+    CHECK(*v[4] == 30);
+
+    auto values = v | views::values;
+    CHECK(&*values.begin() == &*v[1]);
+    CHECK(std::ranges::distance(values) == 3);
+
+    STATIC_REQUIRE(std::ranges::bidirectional_range<decltype(values)>);
+    STATIC_REQUIRE(std::ranges::common_range<decltype(values)>);
+    STATIC_REQUIRE(std::ranges::borrowed_range<decltype(values)>);
+    STATIC_REQUIRE(std::same_as<std::ranges::range_reference_t<decltype(values)>, int &>);
+
+    auto const &const_values = values;
+    CHECK(*std::ranges::next(const_values.begin(), 2) == 30);
+    CHECK(*std::ranges::prev(values.end()) == 30);
+
+    std::vector<expected<int, std::string>> const all_errors {unexpected<std::string>("x"), unexpected<std::string>("y")};
+    CHECK(std::ranges::empty(all_errors | views::values));
+}
+
+TEST_CASE("views::errors yields references to the errors", "[views]")
+{
+    auto const v      = mixed();
+    auto       errors = v | views::errors;
+
+    CHECK(to_vector(errors) == std::vector<std::string> {"a", "b", "c"});
+    CHECK(&*errors.begin() == &v[0].error());
+    STATIC_REQUIRE(std::same_as<std::ranges::range_reference_t<decltype(errors)>, const std::string &>);
+
+    std::vector<expected<void, int>> const voids {{}, unexpected(1), {}, unexpected(2)};
+    CHECK(to_vector(voids | views::errors) == std::vector<int> {1, 2});
+}
+
+TEST_CASE("views::values and views::errors do not copy", "[views]")
+{
+    using V = operation_counter::counted<struct views_value_tag>;
+    using E = operation_counter::counted<struct views_error_tag>;
+
+    std::vector<expected<V, E>> v(3);
+    v[1] = unexpected<E>(std::in_place);
+
+    operation_counter::reset<V, E>();
+    std::size_t values = 0;
+    for (auto &x : v | views::values)
+    {
+        (void) x;
+        ++values;
+    }
+    std::size_t errors = 0;
+    for (auto &x : v | views::errors)
+    {
+        (void) x;
+        ++errors;
+    }
+    CHECK(values == 2);
+    CHECK(errors == 1);
+    CHECK(V::stats() == operation_counter::counts {});
+    CHECK(E::stats() == operation_counter::counts {});
+}
+
+TEST_CASE("views over single pass and forward ranges", "[views]")
+{
+    std::forward_list<expected<int, int>> const list {unexpected(0), 1, unexpected(2), 3};
+    auto                                        values = list | views::values;
+    STATIC_REQUIRE(std::ranges::forward_range<decltype(values)>);
+    STATIC_REQUIRE(!std::ranges::bidirectional_range<decltype(values)>);
+    CHECK(to_vector(values) == std::vector<int> {1, 3});
+
+    std::vector<expected<int, int>> v {1, 2, unexpected(3), 4};
+    auto input = std::ranges::subrange(std::counted_iterator(v.begin(), 3), std::default_sentinel) | views::values;
+    CHECK(to_vector(input) == std::vector<int> {1, 2});
+
+    // rvalue elements are moved out of
+    std::vector<expected<std::unique_ptr<int>, int>> owners;
+    owners.emplace_back(std::make_unique<int>(5));
+    owners.emplace_back(unexpect, 1);
+    std::vector<std::unique_ptr<int>> moved;
+    for (auto &&p : owners | std::views::transform([](auto &e) -> auto && { return std::move(e); }) | views::values)
+    {
+        moved.push_back(std::move(p));
+    }
+    REQUIRE(moved.size() == 1);
+    CHECK(*moved[0] == 5);
+    CHECK(owners[0].value() == nullptr);
+}
+
+TEST_CASE("views::take_until_error stops before the first error", "[views]")
+{
+    std::vector<expected<int, int>> v {1, 2, 3, unexpected(4), 5};
+
+    auto prefix = v | views::take_until_error;
+    STATIC_REQUIRE(std::ranges::contiguous_range<decltype(prefix)>);
+    STATIC_REQUIRE(std::ranges::sized_range<decltype(prefix)>);
+    STATIC_REQUIRE(std::ranges::borrowed_range<decltype(prefix)>);
+    CHECK(prefix.size() == 3);
+    CHECK(prefix.data() == v.data());
+    CHECK(to_vector(prefix | views::values) == std::vector<int> {1, 2, 3});
+
+    auto const copy = prefix;
+    CHECK(copy.size() == 3);
+    CHECK(std::ranges::size(std::as_const(v) | views::take_until_error) == 3);
+
+    auto const cached = v | views::take_until_error;
+    CHECK(cached.size() == 3);
+    v[0] = unexpected(0);
+    CHECK(cached.end() == v.begin() + 3);
+    v[0] = 1;
+
+    std::vector<expected<int, int>> const clean(100, 7);
+    CHECK(std::ranges::size(clean | views::take_until_error) == 100);
+    CHECK(std::ranges::empty(std::vector<expected<int, int>> {unexpected(1)} | views::take_until_error));
+
+    std::list<expected<int, int>> const list {1, unexpected(2), 3};
+    auto                                list_prefix = list | views::take_until_error;
+    STATIC_REQUIRE(!std::ranges::sized_range<decltype(list_prefix)>);
+    CHECK(std::ranges::distance(list_prefix) == 1);
+
+    std::array<expected<void, int>, 3> const voids {expected<void, int> {}, expected<void, int> {}, unexpected(1)};
+    CHECK(std::ranges::size(voids | views::take_until_error) == 2);
+}
+
+TEST_CASE("views::unwrap_or replaces errors with a default", "[views]")
+{
+    std::vector<expected<double, std::string>> const v {1.5, unexpected<std::string>("nan"), 2.5};
+
+    auto values = v | views::unwrap_or(0);
+    STATIC_REQUIRE(std::ranges::random_access_range<decltype(values)>);
+    STATIC_REQUIRE(std::ranges::sized_range<decltype(values)>);
+    STATIC_REQUIRE(std::same_as<std::ranges::range_reference_t<decltype(values)>, const double &>);
+    CHECK(values.size() == 3);
+    CHECK(values[1] == 0.0);
+    CHECK(&values[2] == &*v[2]);
+    CHECK(std::ranges::max(values) == 2.5);
+
+    CHECK(to_vector(views::unwrap_or(v, -1.0)) == std::vector<double> {1.5, -1.0, 2.5});
+
+    std::vector<expected<std::string, int>> strings {std::string("a"), unexpected(1)};
+    auto moved = to_vector(strings | std::views::transform([](auto &e) -> auto && { return std::move(e); }) | views::unwrap_or("none"));
+    CHECK(moved == std::vector<std::string> {"a", "none"});
+}
+
+TEST_CASE("views compose with the standard adaptors", "[views]")
+{
+    auto const v = mixed();
+
+    auto prefix = v | views::take_until_error | views::unwrap_or(0);
+    CHECK(to_vector(prefix).empty());
+
+    auto const tail = v | std::views::drop(1) | views::take_until_error | views::values;
+    CHECK(to_vector(tail) == std::vector<int> {1, 2});
+
+    CHECK(std::ranges::count(v | views::errors | std::views::transform(&std::string::size), 1) == 3);
+}
+
+#endif
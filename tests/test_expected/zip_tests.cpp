@@ -0,0 +1,140 @@
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include <catch2/catch_all.hpp>
+
+#include <zeus/expected.hpp>
+#include <zeus/expected/zip.hpp>
+
+#include "operation_counter.hpp"
+
+using namespace zeus;
+
+namespace
+{
+
+struct a_tag;
+struct b_tag;
+struct result_tag;
+struct error_tag;
+
+using A  = operation_counter::counted<a_tag>;
+using B  = operation_counter::counted<b_tag>;
+using R  = operation_counter::counted<result_tag>;
+using Er = operation_counter::counted<error_tag>;
+
+} // namespace
+
+TEST_CASE("zip() combines values into a tuple", "[zip]")
+{
+    expected<int, std::string> const         a {1};
+    expected<std::string, std::string> const b {"two"};
+    expected<double, std::string> const      c {3.0};
+
+    auto const r = zeus::zip(a, b, c);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(r)>, expected<std::tuple<int, std::string, double>, std::string>>);
+    REQUIRE(r.has_value());
+    CHECK(*r == std::make_tuple(1, std::string("two"), 3.0));
+}
+
+TEST_CASE("zip() returns the first error", "[zip]")
+{
+    expected<int, int> const    ok {1};
+    expected<double, int> const bad1 {unexpect, 10};
+    expected<char, int> const   bad2 {unexpect, 20};
+
+    CHECK(zeus::zip(ok, bad1, bad2) == unexpected(10));
+    CHECK(zeus::zip(bad2, ok, bad1) == unexpected(20));
+    CHECK(zeus::zip(ok, ok, bad2) == unexpected(20));
+}
+
+TEST_CASE("zip_with() invokes f only if all arguments hold values", "[zip]")
+{
+    int        calls = 0;
+    auto const sum   = [&](int x, int y) {
+        ++calls;
+        return x + y;
+    };
+
+    CHECK(zeus::zip_with(sum, expected<int, int> {2}, expected<int, int> {3}) == 5);
+    CHECK(calls == 1);
+    CHECK(zeus::zip_with(sum, expected<int, int> {2}, expected<int, int> {unexpect, 3}) == unexpected(3));
+    CHECK(calls == 1);
+}
+
+TEST_CASE("zip() and zip_with() on expected<void, E>", "[zip, void-T]")
+{
+    expected<void, int> const ok;
+    expected<void, int> const bad {unexpect, 4};
+    expected<int, int> const  one {1};
+
+    auto const r = zeus::zip(one, ok, one);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(r)>, expected<std::tuple<int, int>, int>>);
+    CHECK(*r == std::make_tuple(1, 1));
+    CHECK(zeus::zip(one, bad) == unexpected(4));
+
+    int        calls = 0;
+    auto const f     = [&] { ++calls; };
+    auto const v     = zeus::zip_with(f, ok, ok);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(v)>, expected<void, int>>);
+    CHECK(v.has_value());
+    CHECK(zeus::zip_with(f, ok, bad) == unexpected(4));
+    CHECK(calls == 1);
+}
+
+TEST_CASE("zip() forwards rvalue arguments", "[zip]")
+{
+    expected<std::unique_ptr<int>, int> p {std::make_unique<int>(7)};
+    expected<int, int>                  i {1};
+
+    auto const r = zeus::zip(std::move(p), i);
+    CHECK(*std::get<0>(*r) == 7);
+    CHECK(*p == nullptr);
+}
+
+TEST_CASE("zip() operation counts", "[zip, operation-counts]")
+{
+    using operation_counter::copies;
+    using operation_counter::moves;
+    using operation_counter::none;
+
+    expected<A, Er> a {std::in_place, 1};
+    expected<B, Er> b {std::in_place, 2};
+    expected<B, Er> bad {unexpect, 3};
+
+    SECTION("lvalues are copied once")
+    {
+        operation_counter::reset<A, B, Er>();
+        auto const r = zeus::zip(a, b);
+        CHECK(std::get<0>(*r).value == 1);
+        CHECK(A::stats() == copies(1));
+        CHECK(B::stats() == copies(1));
+    }
+    SECTION("rvalues are moved once")
+    {
+        operation_counter::reset<A, B, Er>();
+        auto const r = zeus::zip(std::move(a), std::move(b));
+        CHECK(std::get<1>(*r).value == 2);
+        CHECK(A::stats() == moves(1));
+        CHECK(B::stats() == moves(1));
+    }
+    SECTION("the error is moved once, values are untouched")
+    {
+        operation_counter::reset<A, B, Er>();
+        auto const r = zeus::zip(std::move(a), std::move(bad));
+        CHECK(r.error().value == 3);
+        CHECK(A::stats() == none());
+        CHECK(Er::stats() == moves(1));
+    }
+    SECTION("the result of zip_with() is constructed in place")
+    {
+        operation_counter::reset<A, B, R>();
+        auto const r = zeus::zip_with([](const A& x, const B& y) { return R(x.value + y.value); }, a, b);
+        CHECK(r->value == 3);
+        CHECK(A::stats() == none());
+        CHECK(B::stats() == none());
+        CHECK(R::stats() == none());
+    }
+}
@@ -1,4 +1,5 @@
 #include <zeus/expected.hpp>
+#include <zeus/expected/try.hpp>
 
 #if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
 static_assert(false, "This test must be compiled with exceptions disabled");
@@ -11,6 +12,18 @@ zeus::expected<int, int> try_parse(bool succeed)
     return zeus::unexpected(1);
 }
 
+zeus::expected<int, int> try_increment(bool succeed)
+{
+    ZEUS_EXPECTED_TRY(int v, try_parse(succeed));
+    return v + 1;
+}
+
+zeus::expected<void, int> try_check(bool succeed)
+{
+    ZEUS_EXPECTED_TRY_VOID(try_parse(succeed));
+    return {};
+}
+
 int main()
 {
     auto e = try_parse(true);
@@ -46,5 +59,14 @@ int main()
     if (ev2.error() != 10)
         return 10;
 
+    if (try_increment(true) != 43)
+        return 11;
+    if (try_increment(false) != zeus::unexpected(1))
+        return 12;
+    if (!try_check(true).has_value())
+        return 13;
+    if (try_check(false).error() != 1)
+        return 14;
+
     return 0;
 }